@@ -6,4 +6,10 @@ if(CMAKE_CXX_COMPILER_ID STREQUAL "GNU" OR CMAKE_CXX_COMPILER_ID MATCHES ".*Clan
     set(sanitizers "address,undefined")
     set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fsanitize=${sanitizers}")
   endif()
+
+  # Cannot be combined with the sanitizers above
+  option(${PROJECT_NAME}_enable_thread_sanitizer "Enable thread sanitizer" OFF)
+  if(${PROJECT_NAME}_enable_thread_sanitizer)
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} -fsanitize=thread")
+  endif()
 endif()
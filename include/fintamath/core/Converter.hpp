@@ -1,8 +1,10 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 
 #include "fintamath/core/MultiMethod.hpp"
+#include "fintamath/core/Registries.hpp"
 
 #define REQUIRE_MATH_OBJECTS(To, From)                                        \
   template <typename To, typename From,                                       \
@@ -20,6 +22,7 @@ class Converter {
 public:
   REQUIRE_MATH_OBJECTS(Type, Value)
   static void add(const ConverterFunction<Type, Value> &convertFunc) {
+    Registries::checkNotFrozen();
     getConverter().add<Type, Value>(convertFunc);
   }
 
@@ -19,10 +19,18 @@
 
 namespace fintamath {
 
+class IConstant;
+class IFunction;
+
 class IMathObject {
 public:
   virtual ~IMathObject() = default;
 
+  // Allocated from the current ExpressionArena if there is one
+  static void *operator new(size_t size);
+
+  static void operator delete(void *ptr);
+
   virtual std::unique_ptr<IMathObject> clone() const & = 0;
 
   virtual std::unique_ptr<IMathObject> clone() && = 0;
@@ -37,12 +45,17 @@ public:
 
   virtual MathObjectTypeId getTypeId() const = 0;
 
+  // Objects of the same type that compare equal have equal hashes
+  virtual size_t hash() const {
+    return std::hash<std::string>{}(toString());
+  }
+
   friend inline bool operator==(const IMathObject &lhs, const IMathObject &rhs) {
-    return lhs.equalsAbstract(rhs);
+    return &lhs == &rhs || lhs.equalsAbstract(rhs);
   }
 
   friend inline bool operator!=(const IMathObject &lhs, const IMathObject &rhs) {
-    return !lhs.equalsAbstract(rhs);
+    return !(lhs == rhs);
   }
 
   template <typename T, typename = std::enable_if_t<std::is_base_of_v<IMathObject, T>>>
@@ -30,8 +30,20 @@ public:
     return Derived::getTypeIdStatic();
   }
 
+  size_t hash() const override {
+    if constexpr (isStateless()) {
+      return std::hash<MathObjectTypeId>{}(Derived::getTypeIdStatic());
+    }
+
+    return std::hash<std::string>{}(toString());
+  }
+
 protected:
   virtual bool equals(const Derived &rhs) const {
+    if constexpr (isStateless()) {
+      return true;
+    }
+
     return toString() == rhs.toString();
   }
 
@@ -53,6 +65,12 @@ protected:
     return false;
   }
 
+private:
+  // Constants and functions are fully determined by their type
+  static constexpr bool isStateless() {
+    return std::is_base_of_v<IConstant, Derived> || std::is_base_of_v<IFunction, Derived>;
+  }
+
 private:
 #if !defined(FINTAMATH_I_MATH_OBJECT_CRTP) && !defined(NDEBUG)
 };
@@ -1,9 +1,12 @@
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <unordered_map>
 
+#include "fintamath/core/Registries.hpp"
+
 namespace fintamath {
 
 using MathObjectTypeId = size_t;
@@ -134,48 +137,87 @@ enum class MathObjectType : MathObjectTypeId {
 };
 
 class MathObjectBoundTypeIds {
+  using Id = MathObjectTypeId;
+  using Type = MathObjectType;
+
 public:
+  // Built-in interface ids are multiples of this step
+  static constexpr Id interfaceTypeIdStep = 1000;
+
+  // Upper bounds of built-in interfaces indexed by interface id / interfaceTypeIdStep
+  static constexpr std::array<Id, 13> builtinBoundTypeIds = {
+      Id(Type::None),               // IMathObject
+      Id(Type::ILiteral),           // IArithmetic
+      Id(Type::IComparable),        // IExpression
+      Id(Type::IBinaryExpression),  // IUnaryExpression
+      Id(Type::IPolynomExpression), // IBinaryExpression
+      Id(Type::IComparable),        // IPolynomExpression
+      Id(Type::ILiteral),           // IComparable
+      Id(Type::ILiteral),           // INumber
+      Id(Type::ILiteral),           // IInteger
+      Id(Type::IFunction),          // ILiteral
+      Id(Type::IFunction),          // IConstant
+      Id(Type::None),               // IFunction
+      Id(Type::None),               // IOperator
+  };
+
   static const auto &get() {
     return getBoundTypeIds();
   }
 
   static void reg(size_t toTypeId, size_t fromTypeId) {
+    Registries::checkNotFrozen();
+
     getBoundTypeIds().insert({toTypeId, fromTypeId});
+    hasRegisteredTypeIds = true;
+  }
+
+  static bool hasRegistered() {
+    return hasRegisteredTypeIds;
   }
 
 private:
   static std::unordered_map<MathObjectTypeId, MathObjectTypeId> &getBoundTypeIds() {
-    using Id = MathObjectTypeId;
-    using Type = MathObjectType;
-
-    static std::unordered_map<Id, Id> ids{
-        {Id(Type::IMathObject), Id(Type::None)},
-        {Id(Type::IArithmetic), Id(Type::ILiteral)},
-        {Id(Type::IExpression), Id(Type::IComparable)},
-        {Id(Type::IUnaryExpression), Id(Type::IBinaryExpression)},
-        {Id(Type::IBinaryExpression), Id(Type::IPolynomExpression)},
-        {Id(Type::IPolynomExpression), Id(Type::IComparable)},
-        {Id(Type::IComparable), Id(Type::ILiteral)},
-        {Id(Type::INumber), Id(Type::ILiteral)},
-        {Id(Type::IInteger), Id(Type::ILiteral)},
-        {Id(Type::ILiteral), Id(Type::IFunction)},
-        {Id(Type::IConstant), Id(Type::IFunction)},
-        {Id(Type::IFunction), Id(Type::None)},
-        {Id(Type::IOperator), Id(Type::None)},
-    };
+    static std::unordered_map<Id, Id> ids = [] {
+      std::unordered_map<Id, Id> outIds;
+
+      for (size_t i = 0; i < builtinBoundTypeIds.size(); i++) {
+        outIds.insert({i * interfaceTypeIdStep, builtinBoundTypeIds[i]});
+      }
+
+      return outIds;
+    }();
 
     return ids;
   }
+
+private:
+  static inline bool hasRegisteredTypeIds = false;
 };
 
 inline bool isBaseOf(size_t toTypeId, size_t fromTypeId) {
-  if (auto toTypeBoundaries = MathObjectBoundTypeIds::get().find(toTypeId);
-      toTypeBoundaries != MathObjectBoundTypeIds::get().end()) {
+  using Ids = MathObjectBoundTypeIds;
+
+  if (toTypeId == fromTypeId) {
+    return true;
+  }
+
+  // Built-in interfaces are resolved without touching the registry
+  if (size_t index = toTypeId / Ids::interfaceTypeIdStep;
+      toTypeId % Ids::interfaceTypeIdStep == 0 && index < Ids::builtinBoundTypeIds.size()) {
+
+    return fromTypeId > toTypeId && fromTypeId < Ids::builtinBoundTypeIds[index];
+  }
+
+  if (!Ids::hasRegistered()) {
+    return false;
+  }
 
+  if (auto toTypeBoundaries = Ids::get().find(toTypeId); toTypeBoundaries != Ids::get().end()) {
     return fromTypeId >= toTypeBoundaries->first && fromTypeId < toTypeBoundaries->second;
   }
 
-  return toTypeId == fromTypeId;
+  return false;
 }
 
 }
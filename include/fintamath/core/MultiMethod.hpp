@@ -1,8 +1,11 @@
 #pragma once
 
-#include <functional>
-#include <map>
-#include <tuple>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
 
 #include "fintamath/core/CoreUtils.hpp"
 
@@ -13,36 +16,114 @@ class MultiMethod;
 
 template <typename Res, typename... ArgsBase>
 class MultiMethod<Res(ArgsBase...)> {
-  template <typename>
-  using ArgId = MathObjectTypeId;
+  using CallbackId = std::array<MathObjectTypeId, sizeof...(ArgsBase)>;
 
-  using CallbackId = std::tuple<ArgId<ArgsBase>...>;
+  using Callback = Res (*)(const void *func, const ArgsBase &...args);
 
-  using Callback = std::function<Res(const ArgsBase &...)>;
+  struct Entry {
+    CallbackId id{};
 
-  using Callbacks = std::map<CallbackId, Callback>;
+    Callback callback = nullptr;
+
+    // Owns the functor, so that a replaced entry releases it
+    std::shared_ptr<const void> func;
+  };
+
+  static constexpr size_t minTableSize = 8;
 
 public:
   template <typename... Args, typename Func>
   void add(const Func &func) {
-    callbacks[CallbackId(Args::getTypeIdStatic()...)] = [func](const ArgsBase &...args) {
-      return func(cast<Args>(args)...);
+    std::shared_ptr<const Func> funcPtr = std::make_shared<const Func>(func);
+
+    Callback callback = [](const void *inFunc, const ArgsBase &...args) -> Res {
+      return (*static_cast<const Func *>(inFunc))(cast<Args>(args)...);
     };
+
+    insert({CallbackId{Args::getTypeIdStatic()...}, callback, std::move(funcPtr)});
   }
 
   template <typename... Args>
   Res operator()(const Args &...args) const {
-    auto it = callbacks.find(CallbackId(args.getTypeId()...));
-
-    if (it != callbacks.end()) {
-      return it->second(args...);
+    if (const Entry *entry = find(CallbackId{args.getTypeId()...})) {
+      return entry->callback(entry->func.get(), args...);
     }
 
     return {};
   }
 
 private:
-  Callbacks callbacks;
+  static size_t hash(const CallbackId &id) {
+    uint64_t res = 0;
+
+    for (MathObjectTypeId typeId : id) {
+      res = (res ^ uint64_t(typeId)) * 0x9e3779b97f4a7c15ULL;
+    }
+
+    // High bits are the best mixed ones, they are folded into the low bits used by the table mask
+    return size_t(res ^ (res >> 32));
+  }
+
+  const Entry *find(const CallbackId &id) const {
+    if (table.empty()) {
+      return nullptr;
+    }
+
+    size_t mask = table.size() - 1;
+
+    for (size_t i = hash(id) & mask;; i = (i + 1) & mask) {
+      const Entry &entry = table[i];
+
+      if (!entry.callback) {
+        return nullptr;
+      }
+
+      if (entry.id == id) {
+        return &entry;
+      }
+    }
+  }
+
+  void insert(Entry newEntry) {
+    if ((entriesCount + 1) * 2 > table.size()) {
+      rehash(std::max(minTableSize, table.size() * 2));
+    }
+
+    size_t mask = table.size() - 1;
+
+    for (size_t i = hash(newEntry.id) & mask;; i = (i + 1) & mask) {
+      Entry &entry = table[i];
+
+      if (!entry.callback) {
+        entry = std::move(newEntry);
+        entriesCount++;
+        return;
+      }
+
+      if (entry.id == newEntry.id) {
+        entry = std::move(newEntry);
+        return;
+      }
+    }
+  }
+
+  void rehash(size_t tableSize) {
+    std::vector<Entry> oldTable = std::move(table);
+
+    table = std::vector<Entry>(tableSize);
+    entriesCount = 0;
+
+    for (Entry &entry : oldTable) {
+      if (entry.callback) {
+        insert(std::move(entry));
+      }
+    }
+  }
+
+private:
+  std::vector<Entry> table;
+
+  size_t entriesCount = 0;
 };
 
 }
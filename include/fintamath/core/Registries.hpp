@@ -0,0 +1,32 @@
+#pragma once
+
+#include <atomic>
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+
+namespace fintamath {
+
+// Parsers, tokens, converters, expression makers and type bounds are registered during static initialization
+// and only read afterwards, without locks. Once freeze() is called nothing can be registered anymore,
+// so expressions can be parsed and simplified from many threads at once.
+class Registries {
+public:
+  static void freeze() {
+    getFrozenFlag().store(true, std::memory_order_release);
+  }
+
+  static bool isFrozen() {
+    return getFrozenFlag().load(std::memory_order_acquire);
+  }
+
+  static void checkNotFrozen() {
+    if (isFrozen()) {
+      throw InvalidInputException("registries are frozen");
+    }
+  }
+
+private:
+  static std::atomic<bool> &getFrozenFlag();
+};
+
+}
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "fintamath/functions/FunctionArguments.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
+
+namespace fintamath {
+
+// Flat register bytecode of a simplified expression, evaluated without rebuilding the tree.
+// Every instruction writes the register with its own index, operands refer to registers of previous instructions.
+// Registers are kept between calls, so one object must not be evaluated from several threads at once, use copies instead.
+class CompiledExpression {
+public:
+  enum class OpCode : uint8_t {
+    LoadVariable,
+    LoadConstant,
+    Add,
+    Sub,
+    Mul,
+    Div,
+    Neg,
+    Pow,
+    PowInt,
+    Log,
+    Abs,
+    Sqrt,
+    Exp,
+    Ln,
+    Lb,
+    Lg,
+    Sin,
+    Cos,
+    Tan,
+    Cot,
+    Asin,
+    Acos,
+    Atan,
+    Acot,
+    Sinh,
+    Cosh,
+    Tanh,
+    Coth,
+    Asinh,
+    Acosh,
+    Atanh,
+    Acoth,
+  };
+
+  struct Instruction {
+    OpCode code = OpCode::LoadConstant;
+
+    // Register indexes, variable index for LoadVariable, constant index for LoadConstant and the exponent of PowInt
+    size_t lhs = 0;
+
+    size_t rhs = 0;
+  };
+
+public:
+  CompiledExpression(const ArgumentPtr &arg, std::vector<Variable> inVariables);
+
+  // Values are passed in the order of getVariables()
+  template <typename T>
+  T evaluate(const std::vector<T> &values) const;
+
+  // Columns are passed in the order of getVariables() and must have the same size
+  std::vector<double> evaluateBatch(const std::vector<std::vector<double>> &columns) const;
+
+  void evaluateBatch(const std::vector<const double *> &columns, double *output, size_t size) const;
+
+  const std::vector<Variable> &getVariables() const;
+
+  const std::vector<Instruction> &getInstructions() const;
+
+private:
+  // Points evaluated at once by evaluateBatch, small enough for the block registers to stay in cache
+  static constexpr size_t batchBlockSize = 256;
+
+  struct Constant {
+    double doubleValue = 0;
+
+    Real realValue;
+
+    std::optional<Rational> rationalValue;
+
+    int64_t integerValue = 0;
+
+    ArgumentPtr value;
+  };
+
+  size_t compileRec(const ArgumentPtr &arg);
+
+  size_t compileFunction(const IFunction &func, const ArgumentsPtrVector &children);
+
+  size_t compileVariable(const Variable &var);
+
+  size_t compileConstant(const ArgumentPtr &arg);
+
+  size_t addConstant(const ArgumentPtr &arg);
+
+  size_t addInstruction(OpCode code, size_t lhs = 0, size_t rhs = 0);
+
+  void evaluateBlock(const std::vector<const double *> &columns, std::vector<const double *> &operands, size_t offset, size_t size) const;
+
+  template <typename T>
+  std::vector<T> &getRegisters() const;
+
+private:
+  std::vector<Variable> variables;
+
+  std::vector<Instruction> instructions;
+
+  std::vector<Constant> constants;
+
+  std::unordered_map<const IMathObject *, size_t> compiledRegisters;
+
+  ArgumentsPtrVector compiledArgs;
+
+  mutable std::vector<double> doubleRegisters;
+
+  mutable std::vector<Real> realRegisters;
+
+  mutable std::vector<Rational> rationalRegisters;
+
+  mutable std::vector<double> batchRegisters;
+};
+
+}
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <optional>
+#include <unordered_map>
+
 #include "fintamath/core/CoreConstants.hpp"
 #include "fintamath/core/IArithmetic.hpp"
 #include "fintamath/expressions/IExpression.hpp"
@@ -7,6 +10,8 @@
 
 namespace fintamath {
 
+class CompiledExpression;
+
 struct Term {
   Token name;
 
@@ -24,6 +29,14 @@ public:
 using TermVector = std::vector<std::shared_ptr<Term>>;
 
 class Expression : public IExpressionCRTP<Expression> {
+  using ExpressionMaker = Parser::Function<std::unique_ptr<IMathObject>, const ArgumentsPtrVector &>;
+
+  using ExpressionMakerGroup = std::shared_ptr<std::vector<ExpressionMaker>>;
+
+  // Indexed by function type id relative to IFunction, so that lookups do not depend on function names.
+  // Functions sharing a name (e.g. Add and UnaryPlus) share a group, as they did when makers were looked up by name
+  using ExpressionMakers = std::vector<ExpressionMakerGroup>;
+
 public:
   Expression();
 
@@ -39,6 +52,9 @@ public:
 
   Expression precise(uint8_t precision = FINTAMATH_PRECISION) const;
 
+  // Variables are ordered as in getVariables() if none are given
+  CompiledExpression compile(const std::vector<Variable> &variables = {}) const;
+
   std::shared_ptr<IFunction> getFunction() const override;
 
   ArgumentsPtrVector getChildren() const override;
@@ -55,7 +71,9 @@ public:
 
   template <typename Function, bool isPolynomial = false, typename Maker>
   static void registerFunctionExpressionMaker(Maker &&maker) {
-    Parser::Function<std::unique_ptr<IMathObject>, const ArgumentsPtrVector &> constructor =
+    Registries::checkNotFrozen();
+
+    ExpressionMaker constructor =
         [maker = std::forward<Maker>(maker)](const ArgumentsPtrVector &args)
         -> std::unique_ptr<IMathObject> {
       //
@@ -79,7 +97,21 @@ public:
       return res;
     };
 
-    Parser::add<Function>(getExpressionMakers(), std::move(constructor));
+    size_t index = Function::getTypeIdStatic() - IFunction::getTypeIdStatic();
+    ExpressionMakers &makers = getExpressionMakers();
+
+    if (index >= makers.size()) {
+      makers.resize(index + 1);
+    }
+
+    ExpressionMakerGroup &group = getExpressionMakerGroups()[Function().toString()];
+
+    if (!group) {
+      group = std::make_shared<std::vector<ExpressionMaker>>();
+    }
+
+    group->emplace_back(std::move(constructor));
+    makers[index] = group;
   }
 
   static MathObjectTypeId getTypeIdStatic() {
@@ -102,28 +134,30 @@ protected:
   ArgumentPtr preciseSimplify() const override;
 
 private:
-  bool parseBinaryOperator(const TermVector &terms, size_t start, size_t end);
+  static ArgumentPtr parseBinaryOperators(const TermVector &terms, size_t &pos, size_t end,
+                                          std::optional<IOperator::Priority> priorityLimit);
 
-  bool parsePrefixOperator(const TermVector &terms, size_t start, size_t end);
+  static ArgumentPtr parseOperand(const TermVector &terms, size_t &pos, size_t end,
+                                  std::optional<IOperator::Priority> priorityLimit);
 
-  bool parsePostfixOperator(const TermVector &terms, size_t start, size_t end);
+  static ArgumentPtr parsePostfixOperators(const TermVector &terms, size_t &pos, size_t end, ArgumentPtr arg);
 
-  bool parseFunction(const TermVector &terms, size_t start, size_t end);
+  static ArgumentPtr parseFunction(const TermVector &terms, size_t &pos, size_t end);
 
-  bool parseBrackets(const TermVector &terms, size_t start, size_t end);
-
-  bool parseFiniteTerm(const TermVector &terms, size_t start, size_t end);
+  static ArgumentPtr parseFunctionOperand(const TermVector &terms, size_t &pos, size_t end);
 
   static ArgumentsPtrVector parseFunctionArgs(const TermVector &terms, size_t start, size_t end);
 
+  static ArgumentPtr parseBrackets(const TermVector &terms, size_t &pos, size_t end);
+
+  static ArgumentPtr parseFiniteTerm(const TermVector &terms, size_t &pos);
+
   static TermVector tokensToTerms(const TokenVector &tokens);
 
   static void insertDelimiters(TermVector &terms);
 
   static bool skipBrackets(const TermVector &terms, size_t &openBracketIndex);
 
-  static void cutBrackets(const TermVector &terms, size_t &start, size_t &end);
-
   static std::string termsToString(const TermVector &terms);
 
   static bool isBinaryOperator(const ArgumentPtr &val);
@@ -138,6 +172,8 @@ private:
 
   static void validateFunctionArgs(const std::shared_ptr<IFunction> &func, const ArgumentsPtrVector &args);
 
+  static void internChild(ArgumentPtr &inChild);
+
   static void preciseRec(ArgumentPtr &arg, uint8_t precision);
 
   friend std::unique_ptr<IMathObject> makeExprChecked(const IFunction &func, const ArgumentsPtrVector &args);
@@ -156,7 +192,9 @@ private:
 
   static Parser::Vector<std::unique_ptr<Term>, const Token &> &getTermMakers();
 
-  static Parser::Map<std::unique_ptr<IMathObject>, const ArgumentsPtrVector &> &getExpressionMakers();
+  static ExpressionMakers &getExpressionMakers();
+
+  static std::unordered_map<std::string, ExpressionMakerGroup> &getExpressionMakerGroups();
 
   template <typename Predicate>
   static ArgumentPtr getTermValueIf(const Term &term, Predicate &&predicate) {
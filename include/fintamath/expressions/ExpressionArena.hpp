@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+
+namespace fintamath {
+
+// While an arena is alive, math objects created with new on this thread (makeExpr, clone, simplifiers)
+// are bump-allocated from its blocks instead of the heap. Deleting such an object only decrements a counter,
+// the blocks are released at once when the arena is destroyed and no object allocated from it is alive.
+// Objects may outlive the arena, they keep its blocks alive. Arenas nest, the innermost one is used.
+// A thread-unsafe arena uses a non-atomic counter, its objects must be destroyed on the thread that created them.
+// Nothing is added to the simplification cache while an arena is active, so the cache never keeps arena blocks alive.
+class ExpressionArena {
+public:
+  struct State;
+
+public:
+  explicit ExpressionArena(bool isThreadSafe = true, size_t blockSize = defaultBlockSize);
+
+  ExpressionArena(const ExpressionArena &rhs) = delete;
+
+  ExpressionArena &operator=(const ExpressionArena &rhs) = delete;
+
+  ~ExpressionArena();
+
+  size_t getAllocatedBytes() const;
+
+  size_t getAllocationsCount() const;
+
+  static ExpressionArena *getCurrent();
+
+  static void *allocate(size_t size);
+
+  static void deallocate(void *ptr);
+
+  // Whether ptr points into a block of a live arena
+  static bool isAllocated(const void *ptr);
+
+private:
+  static constexpr size_t defaultBlockSize = 64 * 1024;
+
+  State *state = nullptr;
+
+  ExpressionArena *previous = nullptr;
+};
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstddef>
+
+#include "fintamath/functions/FunctionArguments.hpp"
+
+namespace fintamath {
+
+class ExpressionInterner {
+public:
+  static ArgumentPtr intern(const ArgumentPtr &arg);
+
+  static size_t hash(const ArgumentPtr &arg);
+
+  static size_t combineHash(size_t seed, size_t value);
+
+  static void setEnabled(bool enabled);
+
+  static bool isEnabled();
+
+  static size_t size();
+
+  static void clear();
+};
+
+}
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <atomic>
+
 #include "fintamath/core/IMathObject.hpp"
 #include "fintamath/functions/IFunction.hpp"
 #include "fintamath/functions/IOperator.hpp"
@@ -11,6 +13,19 @@ namespace fintamath {
 
 class IExpression : public IArithmetic {
 public:
+  IExpression() = default;
+
+  IExpression(const IExpression & /*rhs*/) : IArithmetic() {
+  }
+
+  IExpression &operator=(const IExpression & /*rhs*/) {
+    isSimplifiedFlag = false;
+    subtreeHash = 0;
+    return *this;
+  }
+
+  ~IExpression() override = default;
+
   virtual std::shared_ptr<IFunction> getFunction() const = 0;
 
   virtual ArgumentsPtrVector getChildren() const = 0;
@@ -19,6 +34,9 @@ public:
 
   std::vector<Variable> getVariables() const;
 
+  // Structural hash of the whole subtree, computed once and stored on the node
+  size_t getSubtreeHash() const;
+
   virtual void setVariables(const std::vector<std::pair<Variable, ArgumentPtr>> &varsToVals);
 
   std::unique_ptr<IMathObject> toMinimalObject() const final;
@@ -39,6 +57,7 @@ public:
   }
 
 protected:
+  // simplify, preSimplify and postSimplify return nullptr when nothing changes, unchanged subtrees are shared instead of copied
   virtual ArgumentPtr simplify() const = 0;
 
   virtual ArgumentPtr preSimplify() const;
@@ -61,8 +80,21 @@ protected:
 
   static ArgumentPtr callFunction(const IFunction &func, const ArgumentsPtrVector &argPtrs);
 
+  bool isMarkedSimplified() const;
+
+  void markSimplified() const;
+
+  void resetSubtreeHash();
+
 private:
   static Parser::Vector<std::unique_ptr<IExpression>, const std::string &> &getParser();
+
+private:
+  // Copies are mutable until simplified again, so the flag is never copied
+  mutable std::atomic<bool> isSimplifiedFlag = false;
+
+  // Zero means not computed yet, children are replaced only through setChildren or on fresh copies
+  mutable std::atomic<size_t> subtreeHash = 0;
 };
 
 template <typename Derived, bool isMultiFunction = false>
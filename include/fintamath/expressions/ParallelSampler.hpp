@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include "fintamath/expressions/CompiledExpression.hpp"
+
+namespace fintamath {
+
+// Evaluates a compiled expression over columns of points on several threads.
+// Points are split into fixed chunks, every thread starts on its own contiguous range of chunks and steals
+// from the tail of other ranges when it runs out. Chunk boundaries do not depend on the threads count,
+// so sums are reduced in the same order and give the same result for any threads count.
+class ParallelSampler {
+public:
+  explicit ParallelSampler(CompiledExpression inCompiled, size_t inThreadsCount = 0);
+
+  std::vector<double> evaluate(const std::vector<std::vector<double>> &columns) const;
+
+  std::vector<Real> evaluate(const std::vector<std::vector<Real>> &columns) const;
+
+  double sum(const std::vector<std::vector<double>> &columns) const;
+
+  Real sum(const std::vector<std::vector<Real>> &columns) const;
+
+  size_t getThreadsCount() const;
+
+private:
+  static constexpr size_t chunkSize = 4096;
+
+  template <typename T>
+  std::vector<T> evaluateValues(const std::vector<std::vector<T>> &columns) const;
+
+  template <typename T>
+  T sumValues(const std::vector<std::vector<T>> &columns) const;
+
+  template <typename T>
+  static void evaluateChunk(CompiledExpression &localCompiled, const std::vector<std::vector<T>> &columns, size_t begin, size_t size, T *output);
+
+  template <typename Function>
+  void runChunks(size_t chunksCount, Function &&func) const;
+
+private:
+  CompiledExpression compiled;
+
+  size_t threadsCount = 1;
+};
+
+}
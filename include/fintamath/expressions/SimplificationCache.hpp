@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "fintamath/functions/FunctionArguments.hpp"
+
+namespace fintamath {
+
+class SimplificationCache {
+public:
+  enum class Stage : uint8_t {
+    Simplify,
+    PreSimplify,
+    PostSimplify,
+  };
+
+public:
+  static ArgumentPtr find(const ArgumentPtr &arg, Stage stage = Stage::Simplify);
+
+  // Inserting arg as its own simplArg records that the stage leaves arg unchanged
+  static void insert(const ArgumentPtr &arg, const ArgumentPtr &simplArg, Stage stage = Stage::Simplify);
+
+  static void setCapacity(size_t capacity);
+
+  static size_t getCapacity();
+
+  static size_t size();
+
+  static void clear();
+
+  static size_t getHits();
+
+  static size_t getMisses();
+
+  static void resetStatistics();
+};
+
+}
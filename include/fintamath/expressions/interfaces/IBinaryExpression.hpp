@@ -38,6 +38,8 @@ protected:
 private:
   ArgumentPtr useSimplifyFunctions(const SimplifyFunctionsVector &simplFuncs) const;
 
+  std::shared_ptr<IBinaryExpression> copyIfChanged(const ArgumentPtr &simplLhs, const ArgumentPtr &simplRhs) const;
+
 protected:
   std::shared_ptr<IFunction> func;
 
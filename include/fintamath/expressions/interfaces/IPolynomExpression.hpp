@@ -3,6 +3,8 @@
 #include "fintamath/expressions/IExpression.hpp"
 #include "fintamath/functions/FunctionArguments.hpp"
 
+#include <map>
+#include <shared_mutex>
 #include <stack>
 
 namespace fintamath {
@@ -26,7 +28,38 @@ public:
 protected:
   using SimplifyFunction = std::function<ArgumentPtr(const IFunction &, const ArgumentPtr &, const ArgumentPtr &)>;
 
-  using SimplifyFunctionsVector = std::vector<SimplifyFunction>;
+  // A simplify function with the types of children it can simplify, other children are never passed to it
+  struct SimplifyRule {
+    template <typename Function, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Function>, SimplifyRule>>>
+    SimplifyRule(Function &&inFunction,
+                 MathObjectTypeId inLhsTypeId = IMathObject::getTypeIdStatic(),
+                 MathObjectTypeId inRhsTypeId = IMathObject::getTypeIdStatic())
+        : function(std::forward<Function>(inFunction)),
+          lhsTypeId(inLhsTypeId),
+          rhsTypeId(inRhsTypeId) {
+    }
+
+    SimplifyFunction function;
+
+    MathObjectTypeId lhsTypeId;
+
+    MathObjectTypeId rhsTypeId;
+  };
+
+  // Rules indexed by the types of children, so that only the rules accepting them are tried
+  class SimplifyFunctionsVector {
+  public:
+    SimplifyFunctionsVector(std::initializer_list<SimplifyRule> inRules);
+
+    const std::vector<const SimplifyRule *> &getRules(MathObjectTypeId lhsTypeId, MathObjectTypeId rhsTypeId) const;
+
+  private:
+    std::vector<SimplifyRule> rules;
+
+    mutable std::map<std::pair<MathObjectTypeId, MathObjectTypeId>, std::vector<const SimplifyRule *>> rulesIndex;
+
+    mutable std::shared_mutex mutex;
+  };
 
   using ExprTreePathStack = std::stack<std::pair<const std::shared_ptr<const IExpression>, size_t>>;
 
@@ -39,9 +72,9 @@ protected:
     int size = 0;
   };
 
-  virtual SimplifyFunctionsVector getFunctionsForPreSimplify() const;
+  virtual const SimplifyFunctionsVector &getFunctionsForPreSimplify() const;
 
-  virtual SimplifyFunctionsVector getFunctionsForPostSimplify() const;
+  virtual const SimplifyFunctionsVector &getFunctionsForPostSimplify() const;
 
   virtual std::string operatorChildToString(const ArgumentPtr &inChild, const ArgumentPtr &prevChild) const;
 
@@ -69,12 +102,18 @@ protected:
   virtual bool isComparableOrderInversed() const;
 
 private:
-  void simplifyRec(bool isPostSimplify);
+  void simplifyNeighbors(std::shared_ptr<IPolynomExpression> &simpl, bool isPostSimplify) const;
+
+  ArgumentPtr simplifyNeighbors(const ArgumentPtr &lhs, const ArgumentPtr &rhs, bool isPostSimplify) const;
+
+  std::shared_ptr<IPolynomExpression> simplifyChildren(bool isPostSimplify) const;
+
+  bool isFlatChild(const ArgumentPtr &child) const;
 
-  void simplifyChildren(bool isPostSimplify);
+  ArgumentPtr useSimplifyFunctions(const SimplifyFunctionsVector &simplFuncs, const ArgumentPtr &lhs,
+                                   const ArgumentPtr &rhs) const;
 
-  ArgumentPtr useSimplifyFunctions(const SimplifyFunctionsVector &simplFuncs, size_t lhsChildPos,
-                                   size_t rhsChildPos) const;
+  bool isSorted() const;
 
   void sort();
 
@@ -38,6 +38,8 @@ protected:
 private:
   ArgumentPtr useSimplifyFunctions(const SimplifyFunctionsVector &simplFuncs) const;
 
+  std::shared_ptr<IUnaryExpression> copyIfChanged(const ArgumentPtr &simplChild) const;
+
 protected:
   std::shared_ptr<IFunction> func;
 
@@ -29,11 +29,19 @@ public:
     order = inOrder;
   }
 
+  size_t hash() const override {
+    return std::hash<size_t>{}(order);
+  }
+
   static MathObjectTypeId getTypeIdStatic() {
     return MathObjectTypeId(MathObjectType::Factorial);
   }
 
 protected:
+  bool equals(const Factorial &rhs) const override {
+    return order == rhs.order;
+  }
+
   std::unique_ptr<IMathObject> call(const ArgumentsRefVector &argsVect) const override;
 
 private:
@@ -21,6 +21,12 @@ public:
     return MathObjectTypeId(MathObjectType::Root);
   }
 
+  // Bounds the factorization of integers under the radical, see factorsWithBudget.
+  // Hard composites are left under the radical instead of stalling
+  static void setFactorsMaxWork(size_t maxWork);
+
+  static size_t getFactorsMaxWork();
+
 protected:
   std::unique_ptr<IMathObject> call(const ArgumentsRefVector &argsVect) const override;
 
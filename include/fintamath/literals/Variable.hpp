@@ -13,10 +13,15 @@ public:
 
   std::string toString() const override;
 
+  size_t hash() const override;
+
   static MathObjectTypeId getTypeIdStatic() {
     return MathObjectTypeId(MathObjectType::Variable);
   }
 
+protected:
+  bool equals(const Variable &rhs) const override;
+
 private:
   std::string name;
 
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string_view>
 
 #include <boost/multiprecision/cpp_int.hpp>
 
@@ -27,7 +29,16 @@ public:
   explicit Integer(std::string str);
 
   template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
-  explicit Integer(T val) : backend(val) {
+  explicit Integer(T val) {
+    if constexpr (std::is_integral_v<T> && (std::is_signed_v<T> ? sizeof(T) <= sizeof(int64_t)
+                                                                 : sizeof(T) < sizeof(int64_t))) {
+      smallBackend = int64_t(val);
+    }
+    else {
+      backend = val;
+      isSmallBackend = false;
+      normalize();
+    }
   }
 
   Integer(int64_t val);
@@ -36,11 +47,32 @@ public:
 
   int sign() const;
 
-  const boost::multiprecision::cpp_int &getBackend() const;
+  size_t hash() const override;
+
+  // Number of significant bits in the absolute value, 0 for zero
+  size_t bitLength() const;
+
+  // Bit of the absolute value at the given position
+  bool bit(size_t index) const;
+
+  // Copies big values, hot paths use the overload below instead
+  boost::multiprecision::cpp_int getBackend() const;
+
+  // Big values are returned without copying, small ones are stored in smallBuffer first
+  const boost::multiprecision::cpp_int &getBackend(boost::multiprecision::cpp_int &smallBuffer) const;
+
+  static std::optional<Integer> tryParse(std::string_view str);
 
   template <typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
   explicit operator T() const {
-    return backend.convert_to<T>();
+    if constexpr (std::is_same_v<T, int64_t>) {
+      if (isSmallBackend) {
+        return smallBackend;
+      }
+    }
+
+    boost::multiprecision::cpp_int buffer;
+    return getBackend(buffer).template convert_to<T>();
   }
 
   static MathObjectTypeId getTypeIdStatic() {
@@ -83,7 +115,17 @@ protected:
   Integer &decrease() override;
 
 private:
+  void toBigBackend();
+
+  void normalize();
+
+private:
+  // Values fitting in int64_t are always stored inline in smallBackend
   boost::multiprecision::cpp_int backend;
+
+  int64_t smallBackend = 0;
+
+  bool isSmallBackend = true;
 };
 
 }
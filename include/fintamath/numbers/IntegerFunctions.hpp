@@ -5,10 +5,32 @@
 
 namespace fintamath {
 
-// Use exponentiation by squaring with constant auxiliary memory (iterative version).
-// https://en.wikipedia.org/wiki/Exponentiation_by_squaring#With_constant_auxiliary_memory.
+class Rational;
+class Real;
+
+// Use left-to-right binary exponentiation over the exponent bits, rhs must be non-negative.
+// https://en.wikipedia.org/wiki/Exponentiation_by_squaring.
+template <typename Lhs>
+Lhs binaryPow(const Lhs &lhs, const Integer &rhs) {
+  if (rhs == 0) {
+    return Lhs(1);
+  }
+
+  Lhs res = lhs;
+
+  for (size_t i = rhs.bitLength() - 1; i > 0; i--) {
+    res = res * res;
+
+    if (rhs.bit(i - 1)) {
+      res = res * lhs;
+    }
+  }
+
+  return res;
+}
+
 template <typename Lhs, typename = std::enable_if_t<std::is_base_of_v<INumber, Lhs>>>
-Lhs pow(const Lhs &lhs, Integer rhs) {
+Lhs pow(const Lhs &lhs, const Integer &rhs) {
   if (lhs == 0 && rhs == 0) {
     throw UndefinedBinaryOperatorException("^", lhs.toString(), rhs.toString());
   }
@@ -17,21 +39,16 @@ Lhs pow(const Lhs &lhs, Integer rhs) {
     return pow(1 / lhs, -rhs);
   }
 
-  Lhs res(1);
-  Lhs sqr = lhs;
-
-  while (rhs != 0) {
-    if ((*(rhs.toString().end() - 1) - '0') % 2 == 0) {
-      rhs /= 2;
-      sqr = sqr * sqr;
-    }
-    else {
-      --rhs;
-      res = res * sqr;
-    }
+  if constexpr (std::is_same_v<Lhs, Rational>) {
+    // Numerator and denominator are coprime, so their powers are too
+    return Lhs(binaryPow(lhs.numerator(), rhs), binaryPow(lhs.denominator(), rhs));
+  }
+  else if constexpr (std::is_same_v<Lhs, Real>) {
+    return Lhs(binaryPow(lhs.getBackend(), rhs));
+  }
+  else {
+    return binaryPow(lhs, rhs);
   }
-
-  return res;
 }
 
 Integer abs(const Integer &rhs);
@@ -44,12 +61,30 @@ Integer sqrt(const Integer &rhs);
 
 Integer sqrt(const Integer &rhs, Integer &remainder);
 
+// Largest res such that lhs^res <= rhs, lhs must be greater than 1 and rhs must be positive.
+// remainder is set to rhs - lhs^res, so rhs is an exact power of lhs if it is zero
+Integer log(const Integer &lhs, const Integer &rhs, Integer &remainder);
+
+// Largest res such that res^degree <= rhs, rhs must be non-negative and degree must be positive.
+// remainder is set to rhs - res^degree, so rhs is a perfect power if it is zero
+Integer root(const Integer &rhs, const Integer &degree, Integer &remainder);
+
+// Smallest res such that rhs = res^exponent, rhs must be greater than 1
+Integer perfectPower(const Integer &rhs, Integer &exponent);
+
 Integer factorial(const Integer &rhs);
 
 Integer factorial(const Integer &rhs, size_t order);
 
+// Deterministic below 3.3 * 10^24, above that it is Baillie-PSW test, which is probabilistic but has no known counterexamples
+bool isPrime(const Integer &rhs);
+
 std::map<Integer, Integer> factors(Integer rhs, Integer limit = -1);
 
+// Factorize with about maxWork word operations at most, a modular multiplication of n-word numbers costs n^2 + 63.
+// Cofactors left unsplit, including the ones too big to test for primality, are kept as they are
+std::map<Integer, Integer> factorsWithBudget(Integer rhs, size_t maxWork);
+
 Integer combinations(const Integer &totalNumber, const Integer &choosedNumber);
 
 Integer multinomialCoefficient(const Integer &totalNumber, const std::vector<Integer> &groupNumbers);
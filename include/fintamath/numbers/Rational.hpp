@@ -22,10 +22,14 @@ public:
 
   int sign() const;
 
+  size_t hash() const override;
+
   const Integer &numerator() const;
 
   const Integer &denominator() const;
 
+  static std::optional<Rational> tryParse(std::string_view str);
+
   static MathObjectTypeId getTypeIdStatic() {
     return MathObjectTypeId(MathObjectType::Rational);
   }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <memory>
+#include <optional>
+#include <string_view>
 
 #include <boost/multiprecision/cpp_dec_float.hpp>
 
@@ -38,6 +40,9 @@ public:
 
   std::string toString() const override;
 
+  // Appends the same string as toString() to buffer, so that many values can be written into one buffer
+  void appendString(std::string &buffer) const;
+
   bool isPrecise() const override;
 
   Real precise(uint8_t precision) const;
@@ -46,6 +51,8 @@ public:
 
   const boost::multiprecision::cpp_dec_float_100 &getBackend() const;
 
+  static std::optional<Real> tryParse(std::string_view str);
+
   static MathObjectTypeId getTypeIdStatic() {
     return MathObjectTypeId(MathObjectType::Real);
   }
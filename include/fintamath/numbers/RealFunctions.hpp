@@ -52,9 +52,13 @@ Real atanh(const Real &rhs);
 
 Real acoth(const Real &rhs);
 
-Real getE();
+const Real &getE();
 
-Real getPi();
+const Real &getPi();
+
+const Real &getLn2();
+
+const Real &getLn10();
 
 Real tgamma(const Real &rhs);
 
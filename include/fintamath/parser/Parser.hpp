@@ -4,15 +4,25 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <tuple>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include "fintamath/core/Registries.hpp"
 #include "fintamath/exceptions/InvalidInputException.hpp"
 #include "fintamath/parser/Tokenizer.hpp"
 
 namespace fintamath {
 
 class Parser {
+  template <typename Type, typename ArgsTuple, typename = void>
+  struct IsTryParsable : std::false_type {};
+
+  template <typename Type, typename... Args>
+  struct IsTryParsable<Type, std::tuple<Args...>, std::void_t<decltype(Type::tryParse(std::declval<Args>()...))>>
+      : std::true_type {};
+
 public:
   template <typename Return, typename... Args>
   using Function = std::function<Return(Args...)>;
@@ -28,6 +38,8 @@ public:
 
   template <typename Type, typename BasePtr, typename... Args>
   static void add(Map<BasePtr, Args...> &parserMap) {
+    Registries::checkNotFrozen();
+
     Function<BasePtr, Args...> constructor = [](const Args &...args) {
       return std::make_unique<Type>(args...);
     };
@@ -40,6 +52,8 @@ public:
 
   template <typename Type, typename BasePtr, typename... Args>
   static void add(Map<BasePtr, Args...> &parserMap, Function<BasePtr, Args...> &&parserFunc) {
+    Registries::checkNotFrozen();
+
     std::string name = std::make_unique<Type>()->toString();
     parserMap.insert({name, std::move(parserFunc)});
 
@@ -48,13 +62,24 @@ public:
 
   template <typename Type, typename BasePtr, typename... Args>
   static void add(Vector<BasePtr, Args...> &parserVect) {
+    Registries::checkNotFrozen();
+
     Function<BasePtr, Args...> constructor = [](const Args &...args) {
-      try {
-        return std::make_unique<Type>(args...);
-      }
-      catch (const InvalidInputException &) {
+      if constexpr (IsTryParsable<Type, std::tuple<const Args &...>>::value) {
+        if (auto value = Type::tryParse(args...)) {
+          return std::make_unique<Type>(std::move(*value));
+        }
+
         return std::unique_ptr<Type>();
       }
+      else {
+        try {
+          return std::make_unique<Type>(args...);
+        }
+        catch (const InvalidInputException &) {
+          return std::unique_ptr<Type>();
+        }
+      }
     };
 
     parserVect.emplace_back(constructor);
@@ -62,6 +87,8 @@ public:
 
   template <typename Type, typename BasePtr, typename... Args>
   static void add(Vector<BasePtr, Args...> &parserVect, Function<BasePtr, Args...> &&parserFunc) {
+    Registries::checkNotFrozen();
+
     parserVect.emplace_back(std::move(parserFunc));
   }
 
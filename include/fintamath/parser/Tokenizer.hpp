@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 namespace fintamath {
@@ -10,22 +12,30 @@ using TokenVector = std::vector<Token>;
 
 class Tokenizer {
 public:
-  static TokenVector tokenize(std::string str);
+  static TokenVector tokenize(std::string_view str);
 
   static void registerToken(const Token &token);
 
 private:
-  static bool appendToken(TokenVector &tokens, Token &token, bool shouldSplit = false);
+  struct TrieNode {
+    std::vector<std::pair<char, size_t>> children;
 
-  static TokenVector splitTokens(const Token &token);
+    bool isTokenEnd = false;
+  };
 
-  static void handleSpaces(std::string &str);
+  using Trie = std::vector<TrieNode>;
+
+  static void appendToken(TokenVector &tokens, std::string_view token, bool shouldSplit = false);
+
+  static size_t findLongestTokenLength(std::string_view str);
+
+  static size_t findChild(const TrieNode &node, char ch);
 
   static bool isDigitOrPoint(char ch);
 
   static bool isSpace(char ch);
 
-  static TokenVector &getRegisteredTokens();
+  static Trie &getRegisteredTokens();
 };
 
 }
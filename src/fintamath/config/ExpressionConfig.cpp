@@ -78,9 +78,14 @@ Parser::Vector<std::unique_ptr<Term>, const Token &> &Expression::getTermMakers(
   return maker;
 }
 
-Parser::Map<std::unique_ptr<IMathObject>, const ArgumentsPtrVector &> &Expression::getExpressionMakers() {
-  static Parser::Map<std::unique_ptr<IMathObject>, const ArgumentsPtrVector &> maker;
-  return maker;
+Expression::ExpressionMakers &Expression::getExpressionMakers() {
+  static ExpressionMakers makers;
+  return makers;
+}
+
+std::unordered_map<std::string, Expression::ExpressionMakerGroup> &Expression::getExpressionMakerGroups() {
+  static std::unordered_map<std::string, ExpressionMakerGroup> groups;
+  return groups;
 }
 
 }
@@ -1,6 +1,7 @@
 #include "fintamath/core/IArithmetic.hpp"
 #include "fintamath/core/IComparable.hpp"
 #include "fintamath/core/IMathObject.hpp"
+#include "fintamath/core/Registries.hpp"
 #include "fintamath/expressions/Expression.hpp"
 #include "fintamath/expressions/IExpression.hpp"
 #include "fintamath/functions/IFunction.hpp"
@@ -81,8 +82,13 @@
 
 namespace fintamath {
 
-TokenVector &Tokenizer::getRegisteredTokens() {
-  static TokenVector registeredTokens;
+std::atomic<bool> &Registries::getFrozenFlag() {
+  static std::atomic<bool> isFrozen = false;
+  return isFrozen;
+}
+
+Tokenizer::Trie &Tokenizer::getRegisteredTokens() {
+  static Trie registeredTokens(1);
   return registeredTokens;
 }
 
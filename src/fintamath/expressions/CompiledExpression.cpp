@@ -0,0 +1,764 @@
+#include "fintamath/expressions/CompiledExpression.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/expressions/ExpressionInterner.hpp"
+#include "fintamath/expressions/IExpression.hpp"
+#include "fintamath/functions/arithmetic/Abs.hpp"
+#include "fintamath/functions/arithmetic/Add.hpp"
+#include "fintamath/functions/arithmetic/Div.hpp"
+#include "fintamath/functions/arithmetic/Frac.hpp"
+#include "fintamath/functions/arithmetic/Mul.hpp"
+#include "fintamath/functions/arithmetic/Neg.hpp"
+#include "fintamath/functions/arithmetic/Sub.hpp"
+#include "fintamath/functions/arithmetic/UnaryPlus.hpp"
+#include "fintamath/functions/hyperbolic/Acosh.hpp"
+#include "fintamath/functions/hyperbolic/Acoth.hpp"
+#include "fintamath/functions/hyperbolic/Asinh.hpp"
+#include "fintamath/functions/hyperbolic/Atanh.hpp"
+#include "fintamath/functions/hyperbolic/Cosh.hpp"
+#include "fintamath/functions/hyperbolic/Coth.hpp"
+#include "fintamath/functions/hyperbolic/Sinh.hpp"
+#include "fintamath/functions/hyperbolic/Tanh.hpp"
+#include "fintamath/functions/logarithms/Lb.hpp"
+#include "fintamath/functions/logarithms/Lg.hpp"
+#include "fintamath/functions/logarithms/Ln.hpp"
+#include "fintamath/functions/logarithms/Log.hpp"
+#include "fintamath/functions/powers/Exp.hpp"
+#include "fintamath/functions/powers/Pow.hpp"
+#include "fintamath/functions/powers/Sqrt.hpp"
+#include "fintamath/functions/trigonometry/Acos.hpp"
+#include "fintamath/functions/trigonometry/Acot.hpp"
+#include "fintamath/functions/trigonometry/Asin.hpp"
+#include "fintamath/functions/trigonometry/Atan.hpp"
+#include "fintamath/functions/trigonometry/Cos.hpp"
+#include "fintamath/functions/trigonometry/Cot.hpp"
+#include "fintamath/functions/trigonometry/Sin.hpp"
+#include "fintamath/functions/trigonometry/Tan.hpp"
+#include "fintamath/literals/constants/E.hpp"
+#include "fintamath/literals/constants/IConstant.hpp"
+#include "fintamath/numbers/IntegerFunctions.hpp"
+#include "fintamath/numbers/RationalFunctions.hpp"
+#include "fintamath/numbers/RealFunctions.hpp"
+
+namespace fintamath {
+
+using OpCode = CompiledExpression::OpCode;
+
+namespace {
+
+struct FunctionOpCode {
+  MathObjectTypeId typeId = 0;
+
+  OpCode code = OpCode::LoadConstant;
+
+  std::string name;
+};
+
+template <typename Function>
+FunctionOpCode makeFunctionOpCode(OpCode code) {
+  return {Function::getTypeIdStatic(), code, Function().toString()};
+}
+
+const std::vector<FunctionOpCode> &getFunctionOpCodes() {
+  static const std::vector<FunctionOpCode> functionOpCodes = {
+      makeFunctionOpCode<Add>(OpCode::Add),
+      makeFunctionOpCode<Sub>(OpCode::Sub),
+      makeFunctionOpCode<Mul>(OpCode::Mul),
+      makeFunctionOpCode<Div>(OpCode::Div),
+      makeFunctionOpCode<Frac>(OpCode::Div),
+      makeFunctionOpCode<Neg>(OpCode::Neg),
+      makeFunctionOpCode<Pow>(OpCode::Pow),
+      makeFunctionOpCode<Log>(OpCode::Log),
+      makeFunctionOpCode<Abs>(OpCode::Abs),
+      makeFunctionOpCode<Sqrt>(OpCode::Sqrt),
+      makeFunctionOpCode<Exp>(OpCode::Exp),
+      makeFunctionOpCode<Ln>(OpCode::Ln),
+      makeFunctionOpCode<Lb>(OpCode::Lb),
+      makeFunctionOpCode<Lg>(OpCode::Lg),
+      makeFunctionOpCode<Sin>(OpCode::Sin),
+      makeFunctionOpCode<Cos>(OpCode::Cos),
+      makeFunctionOpCode<Tan>(OpCode::Tan),
+      makeFunctionOpCode<Cot>(OpCode::Cot),
+      makeFunctionOpCode<Asin>(OpCode::Asin),
+      makeFunctionOpCode<Acos>(OpCode::Acos),
+      makeFunctionOpCode<Atan>(OpCode::Atan),
+      makeFunctionOpCode<Acot>(OpCode::Acot),
+      makeFunctionOpCode<Sinh>(OpCode::Sinh),
+      makeFunctionOpCode<Cosh>(OpCode::Cosh),
+      makeFunctionOpCode<Tanh>(OpCode::Tanh),
+      makeFunctionOpCode<Coth>(OpCode::Coth),
+      makeFunctionOpCode<Asinh>(OpCode::Asinh),
+      makeFunctionOpCode<Acosh>(OpCode::Acosh),
+      makeFunctionOpCode<Atanh>(OpCode::Atanh),
+      makeFunctionOpCode<Acoth>(OpCode::Acoth),
+  };
+  return functionOpCodes;
+}
+
+const FunctionOpCode *findFunctionOpCode(MathObjectTypeId typeId) {
+  const std::vector<FunctionOpCode> &functionOpCodes = getFunctionOpCodes();
+
+  auto iter = std::find_if(functionOpCodes.begin(), functionOpCodes.end(), [typeId](const FunctionOpCode &functionOpCode) {
+    return functionOpCode.typeId == typeId;
+  });
+
+  return iter != functionOpCodes.end() ? &*iter : nullptr;
+}
+
+const std::string &getFunctionName(OpCode code) {
+  const std::vector<FunctionOpCode> &functionOpCodes = getFunctionOpCodes();
+
+  return std::find_if(functionOpCodes.begin(), functionOpCodes.end(), [code](const FunctionOpCode &functionOpCode) {
+           return functionOpCode.code == code;
+         })->name;
+}
+
+double powInt(double lhs, int64_t rhs) {
+  auto exponent = uint64_t(rhs);
+
+  if (rhs < 0) {
+    exponent = ~exponent + 1;
+  }
+
+  double res = 1;
+
+  for (; exponent != 0; exponent >>= 1) {
+    if (exponent & 1) {
+      res *= lhs;
+    }
+
+    lhs *= lhs;
+  }
+
+  return rhs < 0 ? 1 / res : res;
+}
+
+double callPow(double lhs, double rhs) {
+  return std::pow(lhs, rhs);
+}
+
+Real callPow(const Real &lhs, const Real &rhs) {
+  return pow(lhs, rhs);
+}
+
+Rational callPow(const Rational &lhs, const Rational &rhs) {
+  if (rhs.denominator() != 1) {
+    throw UndefinedBinaryOperatorException(Pow().toString(), lhs.toString(), rhs.toString());
+  }
+
+  return pow(lhs, rhs.numerator());
+}
+
+double callLog(double lhs, double rhs) {
+  return std::log(rhs) / std::log(lhs);
+}
+
+Real callLog(const Real &lhs, const Real &rhs) {
+  return log(lhs, rhs);
+}
+
+Rational callLog(const Rational &lhs, const Rational &rhs) {
+  throw UndefinedFunctionException(getFunctionName(OpCode::Log), {lhs.toString(), rhs.toString()});
+}
+
+double callUnary(OpCode code, double rhs) {
+  switch (code) {
+  case OpCode::Neg:
+    return -rhs;
+  case OpCode::Abs:
+    return std::abs(rhs);
+  case OpCode::Sqrt:
+    return std::sqrt(rhs);
+  case OpCode::Exp:
+    return std::exp(rhs);
+  case OpCode::Ln:
+    return std::log(rhs);
+  case OpCode::Lb:
+    return std::log2(rhs);
+  case OpCode::Lg:
+    return std::log10(rhs);
+  case OpCode::Sin:
+    return std::sin(rhs);
+  case OpCode::Cos:
+    return std::cos(rhs);
+  case OpCode::Tan:
+    return std::tan(rhs);
+  case OpCode::Cot:
+    return 1 / std::tan(rhs);
+  case OpCode::Asin:
+    return std::asin(rhs);
+  case OpCode::Acos:
+    return std::acos(rhs);
+  case OpCode::Atan:
+    return std::atan(rhs);
+  case OpCode::Acot:
+    return std::atan(1 / rhs);
+  case OpCode::Sinh:
+    return std::sinh(rhs);
+  case OpCode::Cosh:
+    return std::cosh(rhs);
+  case OpCode::Tanh:
+    return std::tanh(rhs);
+  case OpCode::Coth:
+    return 1 / std::tanh(rhs);
+  case OpCode::Asinh:
+    return std::asinh(rhs);
+  case OpCode::Acosh:
+    return std::acosh(rhs);
+  case OpCode::Atanh:
+    return std::atanh(rhs);
+  case OpCode::Acoth:
+    return std::atanh(1 / rhs);
+  default:
+    throw UndefinedFunctionException(getFunctionName(code), {std::to_string(rhs)});
+  }
+}
+
+Real callUnary(OpCode code, const Real &rhs) {
+  switch (code) {
+  case OpCode::Neg:
+    return -rhs;
+  case OpCode::Abs:
+    return abs(rhs);
+  case OpCode::Sqrt:
+    return sqrt(rhs);
+  case OpCode::Exp:
+    return exp(rhs);
+  case OpCode::Ln:
+    return ln(rhs);
+  case OpCode::Lb:
+    return lb(rhs);
+  case OpCode::Lg:
+    return lg(rhs);
+  case OpCode::Sin:
+    return sin(rhs);
+  case OpCode::Cos:
+    return cos(rhs);
+  case OpCode::Tan:
+    return tan(rhs);
+  case OpCode::Cot:
+    return cot(rhs);
+  case OpCode::Asin:
+    return asin(rhs);
+  case OpCode::Acos:
+    return acos(rhs);
+  case OpCode::Atan:
+    return atan(rhs);
+  case OpCode::Acot:
+    return acot(rhs);
+  case OpCode::Sinh:
+    return sinh(rhs);
+  case OpCode::Cosh:
+    return cosh(rhs);
+  case OpCode::Tanh:
+    return tanh(rhs);
+  case OpCode::Coth:
+    return coth(rhs);
+  case OpCode::Asinh:
+    return asinh(rhs);
+  case OpCode::Acosh:
+    return acosh(rhs);
+  case OpCode::Atanh:
+    return atanh(rhs);
+  case OpCode::Acoth:
+    return acoth(rhs);
+  default:
+    throw UndefinedFunctionException(getFunctionName(code), {rhs.toString()});
+  }
+}
+
+Rational callUnary(OpCode code, const Rational &rhs) {
+  switch (code) {
+  case OpCode::Neg:
+    return -rhs;
+  case OpCode::Abs:
+    return abs(rhs);
+  default:
+    throw UndefinedFunctionException(getFunctionName(code), {rhs.toString()});
+  }
+}
+
+template <typename Function>
+void applyUnary(const double *rhs, double *res, size_t size, Function func) {
+  for (size_t i = 0; i < size; i++) {
+    res[i] = func(rhs[i]);
+  }
+}
+
+template <typename Function>
+void applyBinary(const double *lhs, const double *rhs, double *res, size_t size, Function func) {
+  for (size_t i = 0; i < size; i++) {
+    res[i] = func(lhs[i], rhs[i]);
+  }
+}
+
+// The switch is taken once per block, so every loop has a fixed body the compiler can vectorize
+void callUnary(OpCode code, const double *rhs, double *res, size_t size) {
+  switch (code) {
+  case OpCode::Neg:
+    applyUnary(rhs, res, size, [](double x) { return -x; });
+    break;
+  case OpCode::Abs:
+    applyUnary(rhs, res, size, [](double x) { return std::abs(x); });
+    break;
+  case OpCode::Sqrt:
+    applyUnary(rhs, res, size, [](double x) { return std::sqrt(x); });
+    break;
+  case OpCode::Exp:
+    applyUnary(rhs, res, size, [](double x) { return std::exp(x); });
+    break;
+  case OpCode::Ln:
+    applyUnary(rhs, res, size, [](double x) { return std::log(x); });
+    break;
+  case OpCode::Lb:
+    applyUnary(rhs, res, size, [](double x) { return std::log2(x); });
+    break;
+  case OpCode::Lg:
+    applyUnary(rhs, res, size, [](double x) { return std::log10(x); });
+    break;
+  case OpCode::Sin:
+    applyUnary(rhs, res, size, [](double x) { return std::sin(x); });
+    break;
+  case OpCode::Cos:
+    applyUnary(rhs, res, size, [](double x) { return std::cos(x); });
+    break;
+  case OpCode::Tan:
+    applyUnary(rhs, res, size, [](double x) { return std::tan(x); });
+    break;
+  case OpCode::Cot:
+    applyUnary(rhs, res, size, [](double x) { return 1 / std::tan(x); });
+    break;
+  case OpCode::Asin:
+    applyUnary(rhs, res, size, [](double x) { return std::asin(x); });
+    break;
+  case OpCode::Acos:
+    applyUnary(rhs, res, size, [](double x) { return std::acos(x); });
+    break;
+  case OpCode::Atan:
+    applyUnary(rhs, res, size, [](double x) { return std::atan(x); });
+    break;
+  case OpCode::Acot:
+    applyUnary(rhs, res, size, [](double x) { return std::atan(1 / x); });
+    break;
+  case OpCode::Sinh:
+    applyUnary(rhs, res, size, [](double x) { return std::sinh(x); });
+    break;
+  case OpCode::Cosh:
+    applyUnary(rhs, res, size, [](double x) { return std::cosh(x); });
+    break;
+  case OpCode::Tanh:
+    applyUnary(rhs, res, size, [](double x) { return std::tanh(x); });
+    break;
+  case OpCode::Coth:
+    applyUnary(rhs, res, size, [](double x) { return 1 / std::tanh(x); });
+    break;
+  case OpCode::Asinh:
+    applyUnary(rhs, res, size, [](double x) { return std::asinh(x); });
+    break;
+  case OpCode::Acosh:
+    applyUnary(rhs, res, size, [](double x) { return std::acosh(x); });
+    break;
+  case OpCode::Atanh:
+    applyUnary(rhs, res, size, [](double x) { return std::atanh(x); });
+    break;
+  case OpCode::Acoth:
+    applyUnary(rhs, res, size, [](double x) { return std::atanh(1 / x); });
+    break;
+  default:
+    throw UndefinedFunctionException(getFunctionName(code), {});
+  }
+}
+
+}
+
+CompiledExpression::CompiledExpression(const ArgumentPtr &arg, std::vector<Variable> inVariables)
+    : variables(std::move(inVariables)) {
+
+  // Interning makes equal subtrees share a node, so they are compiled once
+  compileRec(ExpressionInterner::intern(arg));
+
+  compiledRegisters.clear();
+  compiledArgs.clear();
+}
+
+template <typename T>
+T CompiledExpression::evaluate(const std::vector<T> &values) const {
+  if (values.size() != variables.size()) {
+    throw InvalidInputException("expected " + std::to_string(variables.size()) + " values, got " +
+                                std::to_string(values.size()));
+  }
+
+  std::vector<T> &registers = getRegisters<T>();
+
+  for (size_t i = 0; i < instructions.size(); i++) {
+    const Instruction &inst = instructions[i];
+
+    switch (inst.code) {
+    case OpCode::LoadVariable:
+      registers[i] = values[inst.lhs];
+      break;
+    case OpCode::LoadConstant:
+      break;
+    case OpCode::Add:
+      registers[i] = registers[inst.lhs] + registers[inst.rhs];
+      break;
+    case OpCode::Sub:
+      registers[i] = registers[inst.lhs] - registers[inst.rhs];
+      break;
+    case OpCode::Mul:
+      registers[i] = registers[inst.lhs] * registers[inst.rhs];
+      break;
+    case OpCode::Div:
+      registers[i] = registers[inst.lhs] / registers[inst.rhs];
+      break;
+    case OpCode::Pow:
+      registers[i] = callPow(registers[inst.lhs], registers[inst.rhs]);
+      break;
+    case OpCode::PowInt:
+      if constexpr (std::is_same_v<T, double>) {
+        registers[i] = powInt(registers[inst.lhs], constants[inst.rhs].integerValue);
+      }
+      else {
+        registers[i] = pow(registers[inst.lhs], constants[inst.rhs].rationalValue->numerator());
+      }
+      break;
+    case OpCode::Log:
+      registers[i] = callLog(registers[inst.lhs], registers[inst.rhs]);
+      break;
+    default:
+      registers[i] = callUnary(inst.code, registers[inst.lhs]);
+      break;
+    }
+  }
+
+  return registers.back();
+}
+
+std::vector<double> CompiledExpression::evaluateBatch(const std::vector<std::vector<double>> &columns) const {
+  size_t size = columns.empty() ? 0 : columns.front().size();
+
+  std::vector<const double *> columnsData;
+
+  for (const auto &column : columns) {
+    if (column.size() != size) {
+      throw InvalidInputException("columns of different sizes");
+    }
+
+    columnsData.emplace_back(column.data());
+  }
+
+  std::vector<double> output(size);
+  evaluateBatch(columnsData, output.data(), size);
+  return output;
+}
+
+void CompiledExpression::evaluateBatch(const std::vector<const double *> &columns, double *output, size_t size) const {
+  if (columns.size() != variables.size()) {
+    throw InvalidInputException("expected " + std::to_string(variables.size()) + " columns, got " +
+                                std::to_string(columns.size()));
+  }
+
+  if (batchRegisters.size() != instructions.size() * batchBlockSize) {
+    batchRegisters.assign(instructions.size() * batchBlockSize, 0);
+
+    for (size_t i = 0; i < instructions.size(); i++) {
+      if (instructions[i].code == OpCode::LoadConstant) {
+        std::fill_n(&batchRegisters[i * batchBlockSize], batchBlockSize, constants[instructions[i].lhs].doubleValue);
+      }
+    }
+  }
+
+  // Pointers are not kept between calls, copies of this object must not read its registers
+  std::vector<const double *> operands(instructions.size());
+
+  for (size_t i = 0; i < instructions.size(); i++) {
+    operands[i] = &batchRegisters[i * batchBlockSize];
+  }
+
+  for (size_t offset = 0; offset < size; offset += batchBlockSize) {
+    size_t blockSize = std::min(batchBlockSize, size - offset);
+    evaluateBlock(columns, operands, offset, blockSize);
+
+    const double *res = operands.back();
+    std::copy(res, res + blockSize, output + offset);
+  }
+}
+
+void CompiledExpression::evaluateBlock(const std::vector<const double *> &columns, std::vector<const double *> &operands, size_t offset, size_t size) const {
+  for (size_t i = 0; i < instructions.size(); i++) {
+    const Instruction &inst = instructions[i];
+    double *res = &batchRegisters[i * batchBlockSize];
+
+    switch (inst.code) {
+    case OpCode::LoadVariable:
+      // Variables are read from their columns in place
+      operands[i] = columns[inst.lhs] + offset;
+      break;
+    case OpCode::LoadConstant:
+      break;
+    case OpCode::Add:
+      applyBinary(operands[inst.lhs], operands[inst.rhs], res, size, std::plus<>());
+      break;
+    case OpCode::Sub:
+      applyBinary(operands[inst.lhs], operands[inst.rhs], res, size, std::minus<>());
+      break;
+    case OpCode::Mul:
+      applyBinary(operands[inst.lhs], operands[inst.rhs], res, size, std::multiplies<>());
+      break;
+    case OpCode::Div:
+      applyBinary(operands[inst.lhs], operands[inst.rhs], res, size, std::divides<>());
+      break;
+    case OpCode::Pow:
+      applyBinary(operands[inst.lhs], operands[inst.rhs], res, size, [](double lhs, double rhs) { return std::pow(lhs, rhs); });
+      break;
+    case OpCode::PowInt: {
+      int64_t exponent = constants[inst.rhs].integerValue;
+
+      if (exponent == 2) {
+        applyUnary(operands[inst.lhs], res, size, [](double x) { return x * x; });
+      }
+      else {
+        applyUnary(operands[inst.lhs], res, size, [exponent](double x) { return powInt(x, exponent); });
+      }
+
+      break;
+    }
+    case OpCode::Log:
+      applyBinary(operands[inst.lhs], operands[inst.rhs], res, size, [](double lhs, double rhs) { return std::log(rhs) / std::log(lhs); });
+      break;
+    default:
+      callUnary(inst.code, operands[inst.lhs], res, size);
+      break;
+    }
+  }
+}
+
+const std::vector<Variable> &CompiledExpression::getVariables() const {
+  return variables;
+}
+
+const std::vector<CompiledExpression::Instruction> &CompiledExpression::getInstructions() const {
+  return instructions;
+}
+
+size_t CompiledExpression::compileRec(const ArgumentPtr &arg) {
+  if (auto iter = compiledRegisters.find(arg.get()); iter != compiledRegisters.end()) {
+    return iter->second;
+  }
+
+  size_t res = 0;
+
+  if (const auto expr = cast<IExpression>(arg)) {
+    if (const auto func = expr->getFunction()) {
+      res = compileFunction(*func, expr->getChildren());
+    }
+    else {
+      res = compileRec(expr->getChildren().front());
+    }
+  }
+  else if (const auto var = cast<Variable>(arg)) {
+    res = compileVariable(*var);
+  }
+  else {
+    res = compileConstant(arg);
+  }
+
+  compiledRegisters.emplace(arg.get(), res);
+  compiledArgs.emplace_back(arg);
+
+  return res;
+}
+
+size_t CompiledExpression::compileFunction(const IFunction &func, const ArgumentsPtrVector &children) {
+  if (is<UnaryPlus>(func)) {
+    return compileRec(children.front());
+  }
+
+  const FunctionOpCode *functionOpCode = findFunctionOpCode(func.getTypeId());
+
+  if (!functionOpCode) {
+    std::vector<std::string> childrenStrings;
+
+    for (const auto &child : children) {
+      childrenStrings.emplace_back(child->toString());
+    }
+
+    throw InvalidInputFunctionException(func.toString(), childrenStrings);
+  }
+
+  OpCode code = functionOpCode->code;
+
+  switch (code) {
+  case OpCode::Add:
+  case OpCode::Mul: {
+    if (code == OpCode::Mul && children.size() > 1 && *children.front() == Integer(-1)) {
+      ArgumentsPtrVector restChildren(children.begin() + 1, children.end());
+      size_t rest = restChildren.size() == 1 ? compileRec(restChildren.front()) : compileFunction(func, restChildren);
+      return addInstruction(OpCode::Neg, rest);
+    }
+
+    size_t res = compileRec(children.front());
+
+    for (size_t i = 1; i < children.size(); i++) {
+      res = addInstruction(code, res, compileRec(children[i]));
+    }
+
+    return res;
+  }
+  case OpCode::Pow: {
+    const ArgumentPtr &exponent = children.back();
+
+    if (const auto intExponent = cast<Integer>(exponent); intExponent && intExponent->bitLength() < 64) {
+      size_t lhs = compileRec(children.front());
+      return addInstruction(OpCode::PowInt, lhs, addConstant(exponent));
+    }
+
+    if (const auto ratExponent = cast<Rational>(exponent); ratExponent && *ratExponent == Rational(1, 2)) {
+      return addInstruction(OpCode::Sqrt, compileRec(children.front()));
+    }
+
+    break;
+  }
+  case OpCode::Log: {
+    const ArgumentPtr &base = children.front();
+
+    if (is<E>(base)) {
+      return addInstruction(OpCode::Ln, compileRec(children.back()));
+    }
+
+    if (*base == Integer(2)) {
+      return addInstruction(OpCode::Lb, compileRec(children.back()));
+    }
+
+    if (*base == Integer(10)) {
+      return addInstruction(OpCode::Lg, compileRec(children.back()));
+    }
+
+    break;
+  }
+  default:
+    break;
+  }
+
+  if (children.size() == 1) {
+    return addInstruction(code, compileRec(children.front()));
+  }
+
+  size_t lhs = compileRec(children.front());
+  size_t rhs = compileRec(children.back());
+  return addInstruction(code, lhs, rhs);
+}
+
+size_t CompiledExpression::compileVariable(const Variable &var) {
+  auto iter = std::find(variables.begin(), variables.end(), var);
+
+  if (iter == variables.end()) {
+    throw InvalidInputException(var.toString());
+  }
+
+  return addInstruction(OpCode::LoadVariable, size_t(iter - variables.begin()));
+}
+
+size_t CompiledExpression::compileConstant(const ArgumentPtr &arg) {
+  return addInstruction(OpCode::LoadConstant, addConstant(arg));
+}
+
+size_t CompiledExpression::addConstant(const ArgumentPtr &arg) {
+  Constant constant;
+  constant.value = arg;
+
+  ArgumentPtr value = arg;
+
+  if (const auto constArg = cast<IConstant>(arg)) {
+    value = (*constArg)();
+  }
+
+  if (const auto intValue = cast<Integer>(value)) {
+    constant.rationalValue = Rational(*intValue);
+    constant.realValue = Real(*intValue);
+
+    if (intValue->bitLength() < 64) {
+      constant.integerValue = int64_t(*intValue);
+    }
+  }
+  else if (const auto ratValue = cast<Rational>(value)) {
+    constant.rationalValue = *ratValue;
+    constant.realValue = Real(*ratValue);
+  }
+  else if (const auto realValue = cast<Real>(value)) {
+    constant.realValue = *realValue;
+  }
+  else {
+    throw InvalidInputException(arg->toString());
+  }
+
+  constant.doubleValue = constant.realValue.getBackend().convert_to<double>();
+
+  constants.emplace_back(std::move(constant));
+  return constants.size() - 1;
+}
+
+size_t CompiledExpression::addInstruction(OpCode code, size_t lhs, size_t rhs) {
+  instructions.emplace_back(Instruction{code, lhs, rhs});
+  return instructions.size() - 1;
+}
+
+template <typename T>
+std::vector<T> &CompiledExpression::getRegisters() const {
+  std::vector<T> *registers = nullptr;
+
+  if constexpr (std::is_same_v<T, double>) {
+    registers = &doubleRegisters;
+  }
+  else if constexpr (std::is_same_v<T, Real>) {
+    registers = &realRegisters;
+  }
+  else {
+    registers = &rationalRegisters;
+  }
+
+  if (registers->size() == instructions.size()) {
+    return *registers;
+  }
+
+  // Constants are loaded once, evaluation skips LoadConstant instructions
+  std::vector<T> newRegisters(instructions.size());
+
+  for (size_t i = 0; i < instructions.size(); i++) {
+    if (instructions[i].code != OpCode::LoadConstant) {
+      continue;
+    }
+
+    const Constant &constant = constants[instructions[i].lhs];
+
+    if constexpr (std::is_same_v<T, double>) {
+      newRegisters[i] = constant.doubleValue;
+    }
+    else if constexpr (std::is_same_v<T, Real>) {
+      newRegisters[i] = constant.realValue;
+    }
+    else {
+      if (!constant.rationalValue) {
+        throw UndefinedException(constant.value->toString());
+      }
+
+      newRegisters[i] = *constant.rationalValue;
+    }
+  }
+
+  *registers = std::move(newRegisters);
+  return *registers;
+}
+
+template double CompiledExpression::evaluate(const std::vector<double> &values) const;
+
+template Real CompiledExpression::evaluate(const std::vector<Real> &values) const;
+
+template Rational CompiledExpression::evaluate(const std::vector<Rational> &values) const;
+
+}
@@ -3,6 +3,8 @@
 #include <algorithm>
 #include <regex>
 
+#include "fintamath/expressions/CompiledExpression.hpp"
+#include "fintamath/expressions/ExpressionInterner.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/expressions/FunctionExpression.hpp"
 #include "fintamath/functions/arithmetic/Add.hpp"
@@ -23,6 +25,7 @@ Expression::Expression() : child(std::make_shared<Integer>(0)) {
 Expression::Expression(const std::string &str) : child(fintamath::parseExpr(str)) {
   validateChild(child);
   simplifyChild(child);
+  internChild(child);
 }
 
 Expression::Expression(const ArgumentPtr &obj) {
@@ -33,6 +36,7 @@ Expression::Expression(const ArgumentPtr &obj) {
     child = obj;
     validateChild(child);
     simplifyChild(child);
+    internChild(child);
   }
 }
 
@@ -52,6 +56,22 @@ Expression Expression::precise(uint8_t precision) const {
   return preciseExpr;
 }
 
+CompiledExpression Expression::compile(const std::vector<Variable> &variables) const {
+  if (!variables.empty()) {
+    return {child, variables};
+  }
+
+  std::vector<Variable> childVariables;
+
+  for (const auto &var : getVariables()) {
+    if (std::find(childVariables.begin(), childVariables.end(), var) == childVariables.end()) {
+      childVariables.emplace_back(var);
+    }
+  }
+
+  return {child, childVariables};
+}
+
 ArgumentPtr parseExpr(const std::string &str) {
   return parseExpr(Expression::tokensToTerms(Tokenizer::tokenize(str)));
 }
@@ -65,137 +85,143 @@ ArgumentPtr parseExpr(const TermVector &terms, size_t start, size_t end) {
     throw InvalidInputException(Expression::termsToString(terms));
   }
 
-  Expression res;
+  size_t pos = start;
+  ArgumentPtr res = Expression::parseBinaryOperators(terms, pos, end, {});
 
-  if (res.parseBinaryOperator(terms, start, end) ||
-      res.parsePrefixOperator(terms, start, end) ||
-      res.parsePostfixOperator(terms, start, end) ||
-      res.parseFunction(terms, start, end) ||
-      res.parseBrackets(terms, start, end) ||
-      res.parseFiniteTerm(terms, start, end)) {
-    return res.child;
+  if (pos != end) {
+    throw InvalidInputException(Expression::termsToString(terms));
   }
 
-  throw InvalidInputException(Expression::termsToString(terms));
+  return res;
 }
 
-bool Expression::parseBinaryOperator(const TermVector &terms, size_t start, size_t end) {
-  // TODO! use more efficient algorithm
+ArgumentPtr Expression::parseBinaryOperators(const TermVector &terms, size_t &pos, size_t end,
+                                             std::optional<IOperator::Priority> priorityLimit) {
 
-  size_t foundOperPos = 0;
-  IOperator::Priority foundPriority = IOperator::Priority::Any;
-  bool isPreviousBinaryOper = false;
+  ArgumentPtr lhsArg = parseOperand(terms, pos, end, priorityLimit);
 
-  for (size_t i = start; i < end; i++) {
-    if (skipBrackets(terms, i)) {
-      isPreviousBinaryOper = false;
-      i--;
-      continue;
+  while (pos < end) {
+    auto oper = cast<IOperator>(getTermValueIf(*terms[pos], isBinaryOperator));
+
+    if (!oper) {
+      break;
     }
 
-    if (auto oper = cast<IOperator>(getTermValueIf(*terms[i], isBinaryOperator))) {
-      if (!isPreviousBinaryOper) {
-        IOperator::Priority priority = oper->getOperatorPriority();
+    IOperator::Priority priority = oper->getOperatorPriority();
 
-        if (foundPriority == IOperator::Priority::Any ||
-            foundPriority < priority ||
-            (foundPriority == priority && foundOperPos < i)) {
+    if (priorityLimit && priority >= *priorityLimit) {
+      break;
+    }
 
-          foundPriority = priority;
-          foundOperPos = i;
-        }
-      }
+    pos++;
+    ArgumentPtr rhsArg = parseBinaryOperators(terms, pos, end, priority);
+    lhsArg = makeExpr(*oper, lhsArg, rhsArg);
 
-      isPreviousBinaryOper = true;
-    }
-    else {
-      isPreviousBinaryOper = false;
+    if (auto expr = cast<Expression>(lhsArg)) {
+      lhsArg = expr->child;
     }
   }
 
-  if (foundOperPos <= start || foundOperPos + 1 >= end) {
-    return false;
-  }
+  return lhsArg;
+}
 
-  auto foundOper = cast<IOperator>(getTermValueIf(*terms[foundOperPos], isBinaryOperator));
-  ArgumentPtr lhsArg = parseExpr(terms, start, foundOperPos);
-  ArgumentPtr rhsArg = parseExpr(terms, foundOperPos + 1, end);
-  std::shared_ptr<IExpression> funcExpr = cast<IExpression>(makeExpr(*foundOper, lhsArg, rhsArg));
+ArgumentPtr Expression::parseOperand(const TermVector &terms, size_t &pos, size_t end,
+                                     std::optional<IOperator::Priority> priorityLimit) {
 
-  if (auto expr = cast<Expression>(funcExpr)) {
-    *this = std::move(*expr);
-  }
-  else {
-    child = funcExpr;
+  if (pos >= end) {
+    throw InvalidInputException(termsToString(terms));
   }
 
-  return true;
-}
+  if (auto oper = cast<IOperator>(getTermValueIf(*terms[pos], isPrefixOperator)); oper && pos + 1 < end) {
+    // An operator which is also binary takes all operators binding tighter than its binary form,
+    // a prefix only operator takes a single operand
+    IOperator::Priority operandPriorityLimit = IOperator::Priority::Exponentiation;
 
-bool Expression::parsePrefixOperator(const TermVector &terms, size_t start, size_t end) {
-  if (start + 1 >= end) {
-    return false;
-  }
+    if (auto binaryOper = cast<IOperator>(getTermValueIf(*terms[pos], isBinaryOperator))) {
+      operandPriorityLimit = binaryOper->getOperatorPriority();
+
+      if (priorityLimit && *priorityLimit < operandPriorityLimit) {
+        operandPriorityLimit = *priorityLimit;
+      }
+    }
 
-  if (auto oper = cast<IOperator>(getTermValueIf(*terms[start], isPrefixOperator))) {
-    ArgumentPtr arg = parseExpr(terms, start + 1, end);
-    child = makeExpr(*oper, arg);
-    compressChild(child);
-    return true;
+    pos++;
+    ArgumentPtr arg = parseBinaryOperators(terms, pos, end, operandPriorityLimit);
+    ArgumentPtr res = makeExpr(*oper, arg);
+    compressChild(res);
+    return res;
   }
 
-  return false;
+  ArgumentPtr arg = parseFunction(terms, pos, end);
+  return parsePostfixOperators(terms, pos, end, arg);
 }
 
-bool Expression::parsePostfixOperator(const TermVector &terms, size_t start, size_t end) {
-  if (start + 1 >= end) {
-    return false;
-  }
+ArgumentPtr Expression::parsePostfixOperators(const TermVector &terms, size_t &pos, size_t end, ArgumentPtr arg) {
+  while (pos < end) {
+    std::shared_ptr<const IOperator> constOper = cast<IOperator>(getTermValueIf(*terms[pos], isPostfixOperator));
 
-  if (std::shared_ptr<const IOperator> constOper =
-          cast<IOperator>(getTermValueIf(*terms[end - 1], isPostfixOperator))) {
-    if (std::shared_ptr<IOperator> oper = cast<IOperator>(constOper->clone())) {
-      size_t order = 1;
+    if (!constOper) {
+      break;
+    }
 
-      if (auto factor = cast<Factorial>(oper)) {
-        for (; order < end; order++) {
-          if (terms[end - order - 1]->name != oper->toString()) {
-            break;
-          }
-        }
+    // An operator which is also binary is postfix only at the end of the range
+    if (getTermValueIf(*terms[pos], isBinaryOperator) && pos + 1 < end) {
+      break;
+    }
 
-        factor->setOrder(order);
+    std::shared_ptr<IOperator> oper = cast<IOperator>(constOper->clone());
+    size_t order = 1;
+
+    if (auto factor = cast<Factorial>(oper)) {
+      for (; pos + order < end; order++) {
+        if (terms[pos + order]->name != oper->toString()) {
+          break;
+        }
       }
 
-      ArgumentPtr arg = parseExpr(terms, start, end - order);
-      child = makeExpr(*oper, arg);
-      compressChild(child);
-      return true;
+      factor->setOrder(order);
     }
+
+    pos += order;
+    arg = makeExpr(*oper, arg);
+    compressChild(arg);
   }
 
-  return false;
+  return arg;
 }
 
-bool Expression::parseFunction(const TermVector &terms, size_t start, size_t end) {
-  size_t funcPos = start;
+ArgumentPtr Expression::parseFunction(const TermVector &terms, size_t &pos, size_t end) {
+  const Term &funcTerm = *terms[pos];
 
-  if (start + 1 >= end || terms[funcPos]->values.empty()) {
-    return false;
-  }
+  if (funcTerm.values.empty() || !isNonOperatorFunction(funcTerm.values.front()) || pos + 1 >= end ||
+      getTermValueIf(*terms[pos + 1], isBinaryOperator) ||
+      getTermValueIf(*terms[pos + 1], isPostfixOperator)) {
 
-  if (auto termFirstValue = terms[funcPos]->values.front();
-      !is<IFunction>(termFirstValue) || is<IOperator>(termFirstValue)) {
-    return false;
+    return parseBrackets(terms, pos, end);
   }
 
-  start++;
-  cutBrackets(terms, start, end);
+  pos++;
+
+  ArgumentsPtrVector args;
+
+  if (terms[pos]->name == "(") {
+    size_t bracketsEnd = pos;
+    skipBrackets(terms, bracketsEnd);
+
+    if (bracketsEnd > end) {
+      throw InvalidInputException(termsToString(terms));
+    }
+
+    args = parseFunctionArgs(terms, pos + 1, bracketsEnd - 1);
+    pos = bracketsEnd;
+  }
+  else {
+    args.emplace_back(parseFunctionOperand(terms, pos, end));
+  }
 
-  ArgumentsPtrVector args = parseFunctionArgs(terms, start, end);
   std::shared_ptr<const IFunction> func;
 
-  for (const auto &value : terms[funcPos]->values) {
+  for (const auto &value : funcTerm.values) {
     auto valueFunc = cast<IFunction>(value);
 
     if (valueFunc->getFunctionType() == IFunction::Type(args.size()) ||
@@ -205,12 +231,26 @@ bool Expression::parseFunction(const TermVector &terms, size_t start, size_t end
   }
 
   if (!func) {
-    return false;
+    throw InvalidInputException(termsToString(terms));
+  }
+
+  return makeExpr(*func, args);
+}
+
+ArgumentPtr Expression::parseFunctionOperand(const TermVector &terms, size_t &pos, size_t end) {
+  // A function without brackets is applied to a single operand without binary and postfix operators
+  if (getTermValueIf(*terms[pos], isBinaryOperator)) {
+    throw InvalidInputException(termsToString(terms));
   }
 
-  child = makeExpr(*func, args);
+  if (auto oper = cast<IOperator>(getTermValueIf(*terms[pos], isPrefixOperator)); oper && pos + 1 < end) {
+    pos++;
+    ArgumentPtr res = makeExpr(*oper, parseFunctionOperand(terms, pos, end));
+    compressChild(res);
+    return res;
+  }
 
-  return true;
+  return parseFunction(terms, pos, end);
 }
 
 ArgumentsPtrVector Expression::parseFunctionArgs(const TermVector &terms, size_t start, size_t end) {
@@ -219,54 +259,53 @@ ArgumentsPtrVector Expression::parseFunctionArgs(const TermVector &terms, size_t
   }
 
   ArgumentsPtrVector funcArgs;
+  size_t argStart = start;
 
   for (size_t i = start; i < end; i++) {
-    if (terms[i]->name == "(") {
-      skipBrackets(terms, i);
+    if (skipBrackets(terms, i)) {
+      i--;
+      continue;
     }
 
     if (terms[i]->name == ",") {
-      if (i == 0 || i + 1 == end) {
+      if (i + 1 == end) {
         throw InvalidInputException(termsToString(terms));
       }
 
-      ArgumentPtr lhsArg = parseExpr(terms, start, i);
-      ArgumentsPtrVector rhsArgs = parseFunctionArgs(terms, i + 1, end);
-
-      funcArgs.emplace_back(lhsArg);
-      for (const auto &arg : rhsArgs) {
-        funcArgs.emplace_back(ArgumentPtr(arg));
-      }
-
-      return funcArgs;
+      funcArgs.emplace_back(parseExpr(terms, argStart, i));
+      argStart = i + 1;
     }
   }
 
-  funcArgs.emplace_back(parseExpr(terms, start, end));
+  funcArgs.emplace_back(parseExpr(terms, argStart, end));
   return funcArgs;
 }
 
-bool Expression::parseBrackets(const TermVector &terms, size_t start, size_t end) {
-  if (start + 2 >= end) {
-    return false;
+ArgumentPtr Expression::parseBrackets(const TermVector &terms, size_t &pos, size_t end) {
+  if (terms[pos]->name != "(") {
+    return parseFiniteTerm(terms, pos);
   }
 
-  if (terms[start]->name == "(" && terms[end - 1]->name == ")") {
-    cutBrackets(terms, start, end);
-    child = parseExpr(terms, start, end);
-    return true;
+  size_t bracketsEnd = pos;
+  skipBrackets(terms, bracketsEnd);
+
+  if (bracketsEnd > end) {
+    throw InvalidInputException(termsToString(terms));
   }
 
-  return false;
+  ArgumentPtr res = parseExpr(terms, pos + 1, bracketsEnd - 1);
+  pos = bracketsEnd;
+  return res;
 }
 
-bool Expression::parseFiniteTerm(const TermVector &terms, size_t start, size_t end) {
-  if (start + 1 != end || terms[start]->values.size() != 1) {
-    return false;
+ArgumentPtr Expression::parseFiniteTerm(const TermVector &terms, size_t &pos) {
+  if (terms[pos]->values.size() != 1) {
+    throw InvalidInputException(termsToString(terms));
   }
 
-  *this = Expression(terms[start]->values.front());
-  return true;
+  ArgumentPtr res = Expression(terms[pos]->values.front()).child;
+  pos++;
+  return res;
 }
 
 std::shared_ptr<IFunction> Expression::getFunction() const {
@@ -275,26 +314,31 @@ std::shared_ptr<IFunction> Expression::getFunction() const {
 
 Expression &Expression::add(const Expression &rhs) {
   child = makeExprChecked(Add(), *child, *rhs.child);
+  resetSubtreeHash();
   return *this;
 }
 
 Expression &Expression::substract(const Expression &rhs) {
   child = makeExprChecked(Sub(), *child, *rhs.child);
+  resetSubtreeHash();
   return *this;
 }
 
 Expression &Expression::multiply(const Expression &rhs) {
   child = makeExprChecked(Mul(), *child, *rhs.child);
+  resetSubtreeHash();
   return *this;
 }
 
 Expression &Expression::divide(const Expression &rhs) {
   child = makeExprChecked(Div(), *child, *rhs.child);
+  resetSubtreeHash();
   return *this;
 }
 
 Expression &Expression::negate() {
   child = makeExprChecked(Neg(), *child);
+  resetSubtreeHash();
   return *this;
 }
 
@@ -374,17 +418,6 @@ bool Expression::skipBrackets(const TermVector &terms, size_t &openBracketIndex)
   throw InvalidInputException(termsToString(terms));
 }
 
-void Expression::cutBrackets(const TermVector &terms, size_t &start, size_t &end) {
-  if (start + 1 >= end) {
-    return;
-  }
-
-  if (terms[start]->name == "(" && terms[end - 1]->name == ")") {
-    start++;
-    end--;
-  }
-}
-
 std::string Expression::termsToString(const TermVector &terms) {
   std::string res;
 
@@ -483,6 +516,12 @@ void Expression::validateFunctionArgs(const std::shared_ptr<IFunction> &func, co
   }
 }
 
+void Expression::internChild(ArgumentPtr &inChild) {
+  if (ExpressionInterner::isEnabled()) {
+    inChild = ExpressionInterner::intern(inChild);
+  }
+}
+
 void Expression::preciseRec(ArgumentPtr &arg, uint8_t precision) {
   if (const auto realArg = cast<Real>(arg)) {
     arg = std::make_shared<Real>(realArg->precise(precision));
@@ -510,8 +549,14 @@ std::unique_ptr<IMathObject> makeExprChecked(const IFunction &func, const Argume
 }
 
 std::unique_ptr<IMathObject> makeExpr(const IFunction &func, const ArgumentsPtrVector &args) {
-  if (auto expr = Parser::parse(Expression::getExpressionMakers(), func.toString(), args)) {
-    return expr;
+  const Expression::ExpressionMakers &makers = Expression::getExpressionMakers();
+
+  if (size_t index = func.getTypeId() - IFunction::getTypeIdStatic(); index < makers.size() && makers[index]) {
+    for (const auto &maker : *makers[index]) {
+      if (auto expr = maker(args)) {
+        return expr;
+      }
+    }
   }
 
   return std::make_unique<FunctionExpression>(func, args);
@@ -0,0 +1,211 @@
+#include "fintamath/expressions/ExpressionArena.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <vector>
+
+#include "fintamath/core/IMathObject.hpp"
+
+namespace fintamath {
+
+struct ExpressionArena::State {
+  std::vector<std::unique_ptr<std::byte[]>> blocks;
+
+  std::byte *blockPos = nullptr;
+
+  size_t blockRemaining = 0;
+
+  size_t blockSize = 0;
+
+  size_t allocatedBytes = 0;
+
+  size_t allocationsCount = 0;
+
+  // The arena itself holds one reference, every live object holds another
+  std::atomic<size_t> atomicRefsCount = 1;
+
+  size_t refsCount = 1;
+
+  bool isThreadSafe = true;
+};
+
+namespace {
+
+struct BlockRange {
+  const std::byte *end = nullptr;
+
+  ExpressionArena::State *state = nullptr;
+};
+
+// Blocks of all live arenas by their beginnings, so that deallocation knows where the memory came from
+struct BlocksRegistry {
+  std::shared_mutex mutex;
+
+  std::map<const std::byte *, BlockRange> blocks;
+
+  // Heap objects skip the lookup while no arena block is alive
+  std::atomic<size_t> blocksCount = 0;
+};
+
+BlocksRegistry &getBlocksRegistry() {
+  static BlocksRegistry registry;
+  return registry;
+}
+
+thread_local ExpressionArena *currentArena = nullptr;
+
+size_t alignSize(size_t size) {
+  return (size + alignof(std::max_align_t) - 1) / alignof(std::max_align_t) * alignof(std::max_align_t);
+}
+
+ExpressionArena::State *findState(const void *ptr) {
+  BlocksRegistry &registry = getBlocksRegistry();
+
+  if (registry.blocksCount == 0) {
+    return nullptr;
+  }
+
+  const auto *bytePtr = static_cast<const std::byte *>(ptr);
+
+  std::shared_lock lock(registry.mutex);
+
+  auto iter = registry.blocks.upper_bound(bytePtr);
+
+  if (iter == registry.blocks.begin()) {
+    return nullptr;
+  }
+
+  --iter;
+  return bytePtr < iter->second.end ? iter->second.state : nullptr;
+}
+
+void registerBlock(ExpressionArena::State &state, const std::byte *block, size_t size) {
+  BlocksRegistry &registry = getBlocksRegistry();
+  std::unique_lock lock(registry.mutex);
+  registry.blocks.emplace(block, BlockRange{block + size, &state});
+  registry.blocksCount++;
+}
+
+void deleteState(ExpressionArena::State *state) {
+  {
+    BlocksRegistry &registry = getBlocksRegistry();
+    std::unique_lock lock(registry.mutex);
+
+    for (const auto &block : state->blocks) {
+      registry.blocks.erase(block.get());
+      registry.blocksCount--;
+    }
+  }
+
+  delete state;
+}
+
+void addRef(ExpressionArena::State &state) {
+  if (state.isThreadSafe) {
+    state.atomicRefsCount.fetch_add(1, std::memory_order_relaxed);
+  }
+  else {
+    state.refsCount++;
+  }
+}
+
+void releaseRef(ExpressionArena::State *state) {
+  bool isLastRef = state->isThreadSafe
+                       ? state->atomicRefsCount.fetch_sub(1, std::memory_order_acq_rel) == 1
+                       : --state->refsCount == 0;
+
+  if (isLastRef) {
+    deleteState(state);
+  }
+}
+
+void *allocateFromState(ExpressionArena::State &state, size_t size) {
+  if (size > state.blockRemaining) {
+    size_t newBlockSize = std::max(size, state.blockSize);
+    state.blocks.emplace_back(std::make_unique<std::byte[]>(newBlockSize));
+    state.blockPos = state.blocks.back().get();
+    registerBlock(state, state.blockPos, newBlockSize);
+    state.blockRemaining = newBlockSize;
+  }
+
+  void *res = state.blockPos;
+  state.blockPos += size;
+  state.blockRemaining -= size;
+  state.allocatedBytes += size;
+  state.allocationsCount++;
+
+  return res;
+}
+
+}
+
+ExpressionArena::ExpressionArena(bool isThreadSafe, size_t blockSize)
+    : state(new State),
+      previous(currentArena) {
+
+  state->isThreadSafe = isThreadSafe;
+  state->blockSize = alignSize(blockSize);
+  currentArena = this;
+}
+
+ExpressionArena::~ExpressionArena() {
+  currentArena = previous;
+  releaseRef(state);
+}
+
+size_t ExpressionArena::getAllocatedBytes() const {
+  return state->allocatedBytes;
+}
+
+size_t ExpressionArena::getAllocationsCount() const {
+  return state->allocationsCount;
+}
+
+ExpressionArena *ExpressionArena::getCurrent() {
+  return currentArena;
+}
+
+void *ExpressionArena::allocate(size_t size) {
+  if (!currentArena) {
+    return ::operator new(size);
+  }
+
+  State &state = *currentArena->state;
+  void *res = allocateFromState(state, alignSize(size));
+  addRef(state);
+
+  return res;
+}
+
+void ExpressionArena::deallocate(void *ptr) {
+  if (!ptr) {
+    return;
+  }
+
+  if (State *state = findState(ptr)) {
+    // Arena memory is reclaimed as a whole when the last reference is released
+    releaseRef(state);
+  }
+  else {
+    ::operator delete(ptr);
+  }
+}
+
+bool ExpressionArena::isAllocated(const void *ptr) {
+  return ptr && findState(ptr);
+}
+
+void *IMathObject::operator new(size_t size) {
+  return ExpressionArena::allocate(size);
+}
+
+void IMathObject::operator delete(void *ptr) {
+  ExpressionArena::deallocate(ptr);
+}
+
+}
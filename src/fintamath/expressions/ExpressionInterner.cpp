@@ -0,0 +1,169 @@
+#include "fintamath/expressions/ExpressionInterner.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+#include "fintamath/expressions/IExpression.hpp"
+
+namespace fintamath {
+
+namespace {
+
+struct InternTable {
+  std::recursive_mutex mutex;
+
+  std::unordered_multimap<size_t, std::weak_ptr<const IMathObject>> nodes;
+
+  std::unordered_map<const IMathObject *, std::weak_ptr<const IMathObject>> internedNodes;
+
+  size_t sweepThreshold = 1024;
+
+  std::atomic<bool> isEnabled = false;
+};
+
+InternTable &getTable() {
+  static InternTable table;
+  return table;
+}
+
+bool isSameNode(const ArgumentPtr &lhs, const ArgumentPtr &rhs) {
+  if (lhs == rhs) {
+    return true;
+  }
+
+  if (lhs->getTypeId() != rhs->getTypeId()) {
+    return false;
+  }
+
+  const auto lhsExpr = cast<IExpression>(lhs);
+  const auto rhsExpr = cast<IExpression>(rhs);
+
+  if (!lhsExpr || !rhsExpr) {
+    return !lhsExpr && !rhsExpr && lhs->hash() == rhs->hash() && *lhs == *rhs;
+  }
+
+  const auto lhsFunc = lhsExpr->getFunction();
+  const auto rhsFunc = rhsExpr->getFunction();
+
+  if (bool(lhsFunc) != bool(rhsFunc) || (lhsFunc && *lhsFunc != *rhsFunc)) {
+    return false;
+  }
+
+  // Children are interned before their parents, so the structural check reduces to pointer comparison
+  return lhsExpr->getChildren() == rhsExpr->getChildren();
+}
+
+void sweep(InternTable &table) {
+  for (auto iter = table.nodes.begin(); iter != table.nodes.end();) {
+    iter = iter->second.expired() ? table.nodes.erase(iter) : std::next(iter);
+  }
+
+  for (auto iter = table.internedNodes.begin(); iter != table.internedNodes.end();) {
+    iter = iter->second.expired() ? table.internedNodes.erase(iter) : std::next(iter);
+  }
+
+  table.sweepThreshold = std::max<size_t>(1024, table.nodes.size() * 2);
+}
+
+ArgumentPtr internRec(InternTable &table, const ArgumentPtr &arg) {
+  if (auto iter = table.internedNodes.find(arg.get()); iter != table.internedNodes.end() && iter->second.lock() == arg) {
+    return arg;
+  }
+
+  ArgumentPtr node = arg;
+
+  if (const auto expr = cast<IExpression>(arg)) {
+    ArgumentsPtrVector children = expr->getChildren();
+    bool areChildrenChanged = false;
+
+    for (auto &child : children) {
+      ArgumentPtr internedChild = internRec(table, child);
+
+      if (internedChild != child) {
+        child = internedChild;
+        areChildrenChanged = true;
+      }
+    }
+
+    if (areChildrenChanged) {
+      std::shared_ptr<IExpression> newExpr = cast<IExpression>(expr->clone());
+      newExpr->setChildren(children);
+      node = newExpr;
+    }
+  }
+
+  size_t nodeHash = ExpressionInterner::hash(node);
+
+  auto [first, last] = table.nodes.equal_range(nodeHash);
+
+  for (auto iter = first; iter != last; ++iter) {
+    if (ArgumentPtr existing = iter->second.lock(); existing && isSameNode(existing, node)) {
+      return existing;
+    }
+  }
+
+  if (table.nodes.size() >= table.sweepThreshold) {
+    sweep(table);
+  }
+
+  table.nodes.emplace(nodeHash, node);
+  table.internedNodes.insert_or_assign(node.get(), node);
+
+  return node;
+}
+
+}
+
+ArgumentPtr ExpressionInterner::intern(const ArgumentPtr &arg) {
+  if (!arg) {
+    return arg;
+  }
+
+  InternTable &table = getTable();
+  std::scoped_lock lock(table.mutex);
+  return internRec(table, arg);
+}
+
+size_t ExpressionInterner::hash(const ArgumentPtr &arg) {
+  if (!arg) {
+    return 0;
+  }
+
+  // Expression nodes store their hashes, so no lock is needed
+  if (const auto expr = cast<IExpression>(arg)) {
+    return expr->getSubtreeHash();
+  }
+
+  return combineHash(std::hash<size_t>{}(arg->getTypeId()), arg->hash());
+}
+
+size_t ExpressionInterner::combineHash(size_t seed, size_t value) {
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+void ExpressionInterner::setEnabled(bool enabled) {
+  getTable().isEnabled = enabled;
+}
+
+bool ExpressionInterner::isEnabled() {
+  return getTable().isEnabled;
+}
+
+size_t ExpressionInterner::size() {
+  InternTable &table = getTable();
+  std::scoped_lock lock(table.mutex);
+  sweep(table);
+  return table.nodes.size();
+}
+
+void ExpressionInterner::clear() {
+  InternTable &table = getTable();
+  std::scoped_lock lock(table.mutex);
+  table.nodes.clear();
+  table.internedNodes.clear();
+  table.sweepThreshold = 1024;
+}
+
+}
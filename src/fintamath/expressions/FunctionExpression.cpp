@@ -43,13 +43,9 @@ ArgumentsPtrVector FunctionExpression::getChildren() const {
 }
 
 ArgumentPtr FunctionExpression::simplify() const {
-  auto simpl = cast<FunctionExpression>(clone());
+  std::shared_ptr<FunctionExpression> simpl = simplifyChildren(&simplifyChild);
 
-  for (auto &child : simpl->children) {
-    simplifyChild(child);
-  }
-
-  if (ArgumentPtr res = callFunction(*simpl->func, simpl->children)) {
+  if (ArgumentPtr res = callFunction(*func, simpl ? simpl->children : children)) {
     return res;
   }
 
@@ -57,21 +53,14 @@ ArgumentPtr FunctionExpression::simplify() const {
 }
 
 ArgumentPtr FunctionExpression::preSimplify() const {
-  auto simpl = cast<FunctionExpression>(clone());
-
-  for (auto &child : simpl->children) {
-    preSimplifyChild(child);
-  }
-
-  return simpl;
+  return simplifyChildren(&preSimplifyChild);
 }
 
 ArgumentPtr FunctionExpression::postSimplify() const {
-  auto simpl = cast<FunctionExpression>(clone());
+  std::shared_ptr<FunctionExpression> simpl = simplifyChildren(&postSimplifyChild);
   ArgumentsRefVector args;
 
-  for (auto &child : simpl->children) {
-    postSimplifyChild(child);
+  for (const auto &child : simpl ? simpl->children : children) {
     args.emplace_back(*child);
   }
 
@@ -82,6 +71,27 @@ ArgumentPtr FunctionExpression::postSimplify() const {
   return (*func)(args);
 }
 
+std::shared_ptr<FunctionExpression> FunctionExpression::simplifyChildren(void (*simplifyFunc)(ArgumentPtr &)) const {
+  std::shared_ptr<FunctionExpression> simpl;
+
+  for (size_t i = 0; i < children.size(); i++) {
+    ArgumentPtr child = children[i];
+    simplifyFunc(child);
+
+    if (child == children[i]) {
+      continue;
+    }
+
+    if (!simpl) {
+      simpl = cast<FunctionExpression>(clone());
+    }
+
+    simpl->children[i] = child;
+  }
+
+  return simpl;
+}
+
 ArgumentPtr FunctionExpression::preciseSimplify() const {
   auto preciseExpr = cast<FunctionExpression>(clone());
 
@@ -98,5 +108,6 @@ void FunctionExpression::setChildren(const ArgumentsPtrVector &childVect) {
   }
 
   children = childVect;
+  resetSubtreeHash();
 }
 }
@@ -29,6 +29,9 @@ protected:
 
   ArgumentPtr preciseSimplify() const override;
 
+private:
+  std::shared_ptr<FunctionExpression> simplifyChildren(void (*simplifyFunc)(ArgumentPtr &)) const;
+
 private:
   std::shared_ptr<IFunction> func;
 
@@ -1,7 +1,9 @@
 #include "fintamath/expressions/IExpression.hpp"
 
 #include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/expressions/ExpressionInterner.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
+#include "fintamath/expressions/SimplificationCache.hpp"
 #include "fintamath/functions/other/Index.hpp"
 #include "fintamath/literals/Variable.hpp"
 #include "fintamath/literals/constants/IConstant.hpp"
@@ -11,6 +13,25 @@
 
 namespace fintamath {
 
+size_t IExpression::getSubtreeHash() const {
+  if (size_t res = subtreeHash) {
+    return res;
+  }
+
+  size_t res = std::hash<size_t>{}(getTypeId());
+
+  if (const auto func = getFunction()) {
+    res = ExpressionInterner::combineHash(res, func->hash());
+  }
+
+  for (const auto &child : getChildren()) {
+    res = ExpressionInterner::combineHash(res, ExpressionInterner::hash(child));
+  }
+
+  subtreeHash = res;
+  return res;
+}
+
 std::vector<Variable> IExpression::getVariables() const {
   std::vector<Variable> vars;
 
@@ -39,7 +60,17 @@ void IExpression::setVariables(const std::vector<std::pair<Variable, ArgumentPtr
   ArgumentsPtrVector newChildren;
 
   for (auto &child : children) {
-    if (std::shared_ptr<IExpression> exprChild = cast<IExpression>(child->clone())) {
+    if (is<IExpression>(child)) {
+      bool hasVariablesToSet = std::any_of(varsToVals.begin(), varsToVals.end(), [&child](const auto &varToVal) {
+        return hasVariable(child, varToVal.first);
+      });
+
+      if (!hasVariablesToSet) {
+        newChildren.emplace_back(child);
+        continue;
+      }
+
+      std::shared_ptr<IExpression> exprChild = cast<IExpression>(child->clone());
       exprChild->setVariables(varsToVals);
       newChildren.emplace_back(exprChild);
       continue;
@@ -66,7 +97,11 @@ void IExpression::setVariables(const std::vector<std::pair<Variable, ArgumentPtr
 }
 
 std::unique_ptr<IMathObject> IExpression::toMinimalObject() const {
-  return simplify()->clone();
+  if (ArgumentPtr simpl = simplify()) {
+    return simpl->clone();
+  }
+
+  return clone();
 }
 
 std::shared_ptr<IFunction> IExpression::getOutputFunction() const {
@@ -85,8 +120,22 @@ void IExpression::compressChild(ArgumentPtr &child) {
 }
 
 void IExpression::simplifyChild(ArgumentPtr &child) {
-  if (const auto exprChild = cast<IExpression>(child)) {
-    if (const auto simplObj = exprChild->simplify()) {
+  if (const auto exprChild = cast<IExpression>(child); exprChild && !exprChild->isMarkedSimplified()) {
+    if (ArgumentPtr cachedObj = SimplificationCache::find(child)) {
+      child = cachedObj;
+    }
+    else {
+      ArgumentPtr simplObj = exprChild->simplify();
+
+      if (!simplObj) {
+        simplObj = child;
+      }
+
+      if (const auto simplExpr = cast<IExpression>(simplObj)) {
+        simplExpr->markSimplified();
+      }
+
+      SimplificationCache::insert(child, simplObj);
       child = simplObj;
     }
   }
@@ -96,7 +145,15 @@ void IExpression::simplifyChild(ArgumentPtr &child) {
 
 void IExpression::preSimplifyChild(ArgumentPtr &child) {
   if (const auto exprChild = cast<IExpression>(child)) {
-    if (const auto simplObj = exprChild->preSimplify()) {
+    if (ArgumentPtr cachedObj = SimplificationCache::find(child, SimplificationCache::Stage::PreSimplify)) {
+      child = cachedObj;
+      return;
+    }
+
+    ArgumentPtr simplObj = exprChild->preSimplify();
+    SimplificationCache::insert(child, simplObj ? simplObj : child, SimplificationCache::Stage::PreSimplify);
+
+    if (simplObj) {
       child = simplObj;
     }
   }
@@ -104,7 +161,15 @@ void IExpression::preSimplifyChild(ArgumentPtr &child) {
 
 void IExpression::postSimplifyChild(ArgumentPtr &child) {
   if (const auto exprChild = cast<IExpression>(child)) {
-    if (const auto simplObj = exprChild->postSimplify()) {
+    if (ArgumentPtr cachedObj = SimplificationCache::find(child, SimplificationCache::Stage::PostSimplify)) {
+      child = cachedObj;
+      return;
+    }
+
+    ArgumentPtr simplObj = exprChild->postSimplify();
+    SimplificationCache::insert(child, simplObj ? simplObj : child, SimplificationCache::Stage::PostSimplify);
+
+    if (simplObj) {
       child = simplObj;
     }
   }
@@ -180,4 +245,16 @@ void IExpression::constSimplifyant(ArgumentPtr &child) {
   }
 }
 
+bool IExpression::isMarkedSimplified() const {
+  return isSimplifiedFlag;
+}
+
+void IExpression::markSimplified() const {
+  isSimplifiedFlag = true;
+}
+
+void IExpression::resetSubtreeHash() {
+  subtreeHash = 0;
+}
+
 }
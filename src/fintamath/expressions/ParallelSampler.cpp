@@ -0,0 +1,242 @@
+#include "fintamath/expressions/ParallelSampler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+
+namespace fintamath {
+
+namespace {
+
+struct ChunkRange {
+  std::mutex mutex;
+
+  size_t begin = 0;
+
+  size_t end = 0;
+};
+
+bool popFront(ChunkRange &range, size_t &chunk) {
+  std::scoped_lock lock(range.mutex);
+
+  if (range.begin == range.end) {
+    return false;
+  }
+
+  chunk = range.begin++;
+  return true;
+}
+
+bool popBack(ChunkRange &range, size_t &chunk) {
+  std::scoped_lock lock(range.mutex);
+
+  if (range.begin == range.end) {
+    return false;
+  }
+
+  chunk = --range.end;
+  return true;
+}
+
+template <typename T>
+size_t getPointsCount(const std::vector<std::vector<T>> &columns, size_t variablesCount) {
+  if (columns.size() != variablesCount) {
+    throw InvalidInputException("expected " + std::to_string(variablesCount) + " columns, got " +
+                                std::to_string(columns.size()));
+  }
+
+  size_t size = columns.empty() ? 0 : columns.front().size();
+
+  for (const auto &column : columns) {
+    if (column.size() != size) {
+      throw InvalidInputException("columns of different sizes");
+    }
+  }
+
+  return size;
+}
+
+}
+
+ParallelSampler::ParallelSampler(CompiledExpression inCompiled, size_t inThreadsCount)
+    : compiled(std::move(inCompiled)),
+      threadsCount(inThreadsCount != 0 ? inThreadsCount : std::max<size_t>(std::thread::hardware_concurrency(), 1)) {
+}
+
+std::vector<double> ParallelSampler::evaluate(const std::vector<std::vector<double>> &columns) const {
+  return evaluateValues(columns);
+}
+
+std::vector<Real> ParallelSampler::evaluate(const std::vector<std::vector<Real>> &columns) const {
+  return evaluateValues(columns);
+}
+
+double ParallelSampler::sum(const std::vector<std::vector<double>> &columns) const {
+  return sumValues(columns);
+}
+
+Real ParallelSampler::sum(const std::vector<std::vector<Real>> &columns) const {
+  return sumValues(columns);
+}
+
+size_t ParallelSampler::getThreadsCount() const {
+  return threadsCount;
+}
+
+template <typename T>
+std::vector<T> ParallelSampler::evaluateValues(const std::vector<std::vector<T>> &columns) const {
+  size_t size = getPointsCount(columns, compiled.getVariables().size());
+  std::vector<T> output(size);
+
+  runChunks((size + chunkSize - 1) / chunkSize, [&](CompiledExpression &localCompiled, size_t chunk) {
+    size_t begin = chunk * chunkSize;
+    evaluateChunk(localCompiled, columns, begin, std::min(chunkSize, size - begin), output.data() + begin);
+  });
+
+  return output;
+}
+
+template <typename T>
+T ParallelSampler::sumValues(const std::vector<std::vector<T>> &columns) const {
+  size_t size = getPointsCount(columns, compiled.getVariables().size());
+  std::vector<T> chunkSums((size + chunkSize - 1) / chunkSize);
+
+  runChunks(chunkSums.size(), [&](CompiledExpression &localCompiled, size_t chunk) {
+    size_t begin = chunk * chunkSize;
+    std::vector<T> values(std::min(chunkSize, size - begin));
+    evaluateChunk(localCompiled, columns, begin, values.size(), values.data());
+
+    T chunkSum = 0;
+
+    for (const auto &value : values) {
+      chunkSum += value;
+    }
+
+    chunkSums[chunk] = chunkSum;
+  });
+
+  // Chunk sums are added in chunk order, whichever thread computed them
+  T res = 0;
+
+  for (const auto &chunkSum : chunkSums) {
+    res += chunkSum;
+  }
+
+  return res;
+}
+
+template <typename T>
+void ParallelSampler::evaluateChunk(CompiledExpression &localCompiled, const std::vector<std::vector<T>> &columns, size_t begin, size_t size, T *output) {
+  if constexpr (std::is_same_v<T, double>) {
+    std::vector<const double *> columnsData;
+
+    for (const auto &column : columns) {
+      columnsData.emplace_back(column.data() + begin);
+    }
+
+    localCompiled.evaluateBatch(columnsData, output, size);
+  }
+  else {
+    std::vector<T> point(columns.size());
+
+    for (size_t i = 0; i < size; i++) {
+      for (size_t j = 0; j < columns.size(); j++) {
+        point[j] = columns[j][begin + i];
+      }
+
+      output[i] = localCompiled.evaluate(point);
+    }
+  }
+}
+
+template <typename Function>
+void ParallelSampler::runChunks(size_t chunksCount, Function &&func) const {
+  size_t workersCount = std::min(threadsCount, chunksCount);
+
+  if (workersCount <= 1) {
+    CompiledExpression localCompiled = compiled;
+
+    for (size_t chunk = 0; chunk < chunksCount; chunk++) {
+      func(localCompiled, chunk);
+    }
+
+    return;
+  }
+
+  // Each worker owns a contiguous range, so it mostly touches memory close to what it touched before
+  std::vector<ChunkRange> ranges(workersCount);
+
+  for (size_t i = 0; i < workersCount; i++) {
+    ranges[i].begin = chunksCount * i / workersCount;
+    ranges[i].end = chunksCount * (i + 1) / workersCount;
+  }
+
+  std::atomic<bool> isFailed = false;
+  std::exception_ptr exception;
+  std::mutex exceptionMutex;
+
+  auto worker = [&](size_t workerIndex) {
+    try {
+      // Compiled expressions keep their registers, so every worker evaluates its own copy
+      CompiledExpression localCompiled = compiled;
+      size_t chunk = 0;
+
+      while (!isFailed && popFront(ranges[workerIndex], chunk)) {
+        func(localCompiled, chunk);
+      }
+
+      for (size_t i = 1; i < workersCount; i++) {
+        ChunkRange &victimRange = ranges[(workerIndex + i) % workersCount];
+
+        while (!isFailed && popBack(victimRange, chunk)) {
+          func(localCompiled, chunk);
+        }
+      }
+    }
+    catch (...) {
+      std::scoped_lock lock(exceptionMutex);
+
+      if (!exception) {
+        exception = std::current_exception();
+      }
+
+      isFailed = true;
+    }
+  };
+
+  std::vector<std::thread> threads;
+
+  try {
+    threads.reserve(workersCount - 1);
+
+    for (size_t i = 1; i < workersCount; i++) {
+      threads.emplace_back(worker, i);
+    }
+  }
+  catch (...) {
+    // Destroying a joinable thread calls std::terminate, so the started workers are stopped and joined first
+    isFailed = true;
+
+    for (auto &thread : threads) {
+      thread.join();
+    }
+
+    throw;
+  }
+
+  worker(0);
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  if (exception) {
+    std::rethrow_exception(exception);
+  }
+}
+
+}
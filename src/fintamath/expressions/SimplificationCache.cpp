@@ -0,0 +1,159 @@
+#include "fintamath/expressions/SimplificationCache.hpp"
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
+#include "fintamath/core/IMathObject.hpp"
+#include "fintamath/expressions/ExpressionArena.hpp"
+#include "fintamath/expressions/ExpressionInterner.hpp"
+
+namespace fintamath {
+
+namespace {
+
+struct CacheEntry {
+  size_t hash = 0;
+
+  SimplificationCache::Stage stage = SimplificationCache::Stage::Simplify;
+
+  ArgumentPtr arg;
+
+  ArgumentPtr simplArg;
+};
+
+struct CacheTable {
+  std::mutex mutex;
+
+  std::list<CacheEntry> entries;
+
+  std::unordered_map<size_t, std::list<CacheEntry>::iterator> entriesMap;
+
+  std::atomic<size_t> capacity = 4096;
+
+  std::atomic<size_t> hits = 0;
+
+  std::atomic<size_t> misses = 0;
+};
+
+CacheTable &getTable() {
+  static CacheTable table;
+  return table;
+}
+
+size_t hashEntry(const ArgumentPtr &arg, SimplificationCache::Stage stage) {
+  return ExpressionInterner::combineHash(ExpressionInterner::hash(arg), size_t(stage));
+}
+
+void shrink(CacheTable &table) {
+  while (table.entries.size() > table.capacity) {
+    table.entriesMap.erase(table.entries.back().hash);
+    table.entries.pop_back();
+  }
+}
+
+}
+
+ArgumentPtr SimplificationCache::find(const ArgumentPtr &arg, Stage stage) {
+  CacheTable &table = getTable();
+
+  if (!arg || table.capacity == 0) {
+    return {};
+  }
+
+  size_t hash = hashEntry(arg, stage);
+  ArgumentPtr cachedArg;
+  ArgumentPtr cachedSimplArg;
+
+  {
+    std::scoped_lock lock(table.mutex);
+
+    if (auto iter = table.entriesMap.find(hash);
+        iter != table.entriesMap.end() && iter->second->stage == stage) {
+
+      table.entries.splice(table.entries.begin(), table.entries, iter->second);
+      cachedArg = iter->second->arg;
+      cachedSimplArg = iter->second->simplArg;
+    }
+  }
+
+  // The deep comparison runs outside of the lock, a hash collision only costs an extra LRU promotion
+  if (!cachedArg || (cachedArg != arg && *cachedArg != *arg)) {
+    table.misses++;
+    return {};
+  }
+
+  table.hits++;
+  return cachedSimplArg == cachedArg ? arg : cachedSimplArg;
+}
+
+void SimplificationCache::insert(const ArgumentPtr &arg, const ArgumentPtr &simplArg, Stage stage) {
+  CacheTable &table = getTable();
+
+  if (!arg || !simplArg || table.capacity == 0) {
+    return;
+  }
+
+  // Cached arena objects would keep their blocks alive for as long as they stay in the cache
+  if (ExpressionArena::getCurrent() || ExpressionArena::isAllocated(arg.get()) || ExpressionArena::isAllocated(simplArg.get())) {
+    return;
+  }
+
+  size_t hash = hashEntry(arg, stage);
+
+  std::scoped_lock lock(table.mutex);
+
+  if (auto iter = table.entriesMap.find(hash); iter != table.entriesMap.end()) {
+    iter->second->stage = stage;
+    iter->second->arg = arg;
+    iter->second->simplArg = simplArg;
+    table.entries.splice(table.entries.begin(), table.entries, iter->second);
+    return;
+  }
+
+  table.entries.push_front({hash, stage, arg, simplArg});
+  table.entriesMap.emplace(hash, table.entries.begin());
+
+  shrink(table);
+}
+
+void SimplificationCache::setCapacity(size_t capacity) {
+  CacheTable &table = getTable();
+  std::scoped_lock lock(table.mutex);
+  table.capacity = capacity;
+  shrink(table);
+}
+
+size_t SimplificationCache::getCapacity() {
+  return getTable().capacity;
+}
+
+size_t SimplificationCache::size() {
+  CacheTable &table = getTable();
+  std::scoped_lock lock(table.mutex);
+  return table.entries.size();
+}
+
+void SimplificationCache::clear() {
+  CacheTable &table = getTable();
+  std::scoped_lock lock(table.mutex);
+  table.entries.clear();
+  table.entriesMap.clear();
+}
+
+size_t SimplificationCache::getHits() {
+  return getTable().hits;
+}
+
+size_t SimplificationCache::getMisses() {
+  return getTable().misses;
+}
+
+void SimplificationCache::resetStatistics() {
+  CacheTable &table = getTable();
+  table.hits = 0;
+  table.misses = 0;
+}
+
+}
@@ -49,10 +49,15 @@ std::string CompExpression::toString() const {
   return IBinaryExpression::toString();
 }
 
+bool CompExpression::equals(const CompExpression &rhs) const {
+  // Solutions are simplified and printed differently, so they must not be shared with equal non-solutions
+  return isSolution == rhs.isSolution && IBinaryExpressionCRTP::equals(rhs);
+}
+
 ArgumentPtr CompExpression::preSimplify() const {
   auto simpl = IBinaryExpression::preSimplify();
 
-  if (auto simplExpr = cast<CompExpression>(simpl)) {
+  if (const auto *simplExpr = simpl ? cast<CompExpression>(simpl.get()) : this) {
     if (!simplExpr->isSolution &&
         (!is<Integer>(rhsChild) || *rhsChild != Integer(0))) {
 
@@ -17,6 +17,8 @@ public:
   }
 
 protected:
+  bool equals(const CompExpression &rhs) const override;
+
   ArgumentPtr preSimplify() const override;
 
   SimplifyFunctionsVector getFunctionsForPreSimplify() const override;
@@ -22,17 +22,21 @@ ArgumentsPtrVector IBinaryExpression::getChildren() const {
 }
 
 ArgumentPtr IBinaryExpression::preSimplify() const {
-  auto simpl = cast<IBinaryExpression>(clone());
-  preSimplifyChild(simpl->lhsChild);
-  preSimplifyChild(simpl->rhsChild);
+  ArgumentPtr simplLhs = lhsChild;
+  ArgumentPtr simplRhs = rhsChild;
+  preSimplifyChild(simplLhs);
+  preSimplifyChild(simplRhs);
 
-  if (is<Undefined>(simpl->lhsChild) || is<Undefined>(simpl->rhsChild)) {
+  if (is<Undefined>(simplLhs) || is<Undefined>(simplRhs)) {
     return Undefined().clone();
   }
 
-  ArgumentPtr res = simpl->useSimplifyFunctions(getFunctionsForPreSimplify());
+  std::shared_ptr<IBinaryExpression> simpl = copyIfChanged(simplLhs, simplRhs);
+  const IBinaryExpression &current = simpl ? *simpl : *this;
+
+  ArgumentPtr res = current.useSimplifyFunctions(getFunctionsForPreSimplify());
 
-  if (res && *res != *simpl) {
+  if (res && *res != current) {
     preSimplifyChild(res);
     return res;
   }
@@ -41,21 +45,25 @@ ArgumentPtr IBinaryExpression::preSimplify() const {
 }
 
 ArgumentPtr IBinaryExpression::postSimplify() const {
-  auto simpl = cast<IBinaryExpression>(clone());
-  postSimplifyChild(simpl->lhsChild);
-  postSimplifyChild(simpl->rhsChild);
+  ArgumentPtr simplLhs = lhsChild;
+  ArgumentPtr simplRhs = rhsChild;
+  postSimplifyChild(simplLhs);
+  postSimplifyChild(simplRhs);
 
-  if (is<Undefined>(simpl->lhsChild) || is<Undefined>(simpl->rhsChild)) {
+  if (is<Undefined>(simplLhs) || is<Undefined>(simplRhs)) {
     return Undefined().clone();
   }
 
-  if (ArgumentPtr res = callFunction(*simpl->func, {simpl->lhsChild, simpl->rhsChild})) {
+  if (ArgumentPtr res = callFunction(*func, {simplLhs, simplRhs})) {
     return res;
   }
 
-  ArgumentPtr res = simpl->useSimplifyFunctions(getFunctionsForPostSimplify());
+  std::shared_ptr<IBinaryExpression> simpl = copyIfChanged(simplLhs, simplRhs);
+  const IBinaryExpression &current = simpl ? *simpl : *this;
+
+  ArgumentPtr res = current.useSimplifyFunctions(getFunctionsForPostSimplify());
 
-  if (res && *res != *simpl) {
+  if (res && *res != current) {
     postSimplifyChild(res);
     return res;
   }
@@ -71,12 +79,27 @@ ArgumentPtr IBinaryExpression::preciseSimplify() const {
 }
 
 ArgumentPtr IBinaryExpression::simplify() const {
-  ArgumentPtr simpl = cast<IBinaryExpression>(clone());
-  preSimplifyChild(simpl);
+  ArgumentPtr simpl = preSimplify();
+
+  if (!simpl) {
+    return postSimplify();
+  }
+
   postSimplifyChild(simpl);
   return simpl;
 }
 
+std::shared_ptr<IBinaryExpression> IBinaryExpression::copyIfChanged(const ArgumentPtr &simplLhs, const ArgumentPtr &simplRhs) const {
+  if (simplLhs == lhsChild && simplRhs == rhsChild) {
+    return {};
+  }
+
+  auto simpl = cast<IBinaryExpression>(clone());
+  simpl->lhsChild = simplLhs;
+  simpl->rhsChild = simplRhs;
+  return simpl;
+}
+
 ArgumentPtr IBinaryExpression::useSimplifyFunctions(const SimplifyFunctionsVector &simplFuncs) const {
   for (const auto &simplFunc : simplFuncs) {
     if (auto res = simplFunc(*func, lhsChild, rhsChild)) {
@@ -102,6 +125,7 @@ void IBinaryExpression::setChildren(const ArgumentsPtrVector &childVect) {
 
   lhsChild = childVect[0];
   rhsChild = childVect[1];
+  resetSubtreeHash();
 }
 
 }
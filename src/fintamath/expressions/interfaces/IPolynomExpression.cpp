@@ -1,5 +1,9 @@
 #include "fintamath/expressions/interfaces/IPolynomExpression.hpp"
 
+#include <algorithm>
+#include <mutex>
+#include <set>
+
 #include "fintamath/core/IComparable.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/expressions/binary/CompExpression.hpp"
@@ -36,23 +40,23 @@ std::string IPolynomExpression::toString() const {
 }
 
 ArgumentPtr IPolynomExpression::simplify() const {
-  ArgumentPtr simpl = cast<IPolynomExpression>(clone());
+  ArgumentPtr simpl = preSimplify();
+
+  if (!simpl) {
+    return postSimplify();
+  }
 
-  preSimplifyChild(simpl);
   postSimplifyChild(simpl);
 
   return simpl;
 }
 
 ArgumentPtr IPolynomExpression::useSimplifyFunctions(const SimplifyFunctionsVector &simplFuncs,
-                                                     size_t lhsChildPos,
-                                                     size_t rhsChildPos) const {
+                                                     const ArgumentPtr &lhs,
+                                                     const ArgumentPtr &rhs) const {
 
-  const auto &lhs = children[lhsChildPos];
-  const auto &rhs = children[rhsChildPos];
-
-  for (const auto &simplFunc : simplFuncs) {
-    if (auto res = simplFunc(*func, lhs, rhs)) {
+  for (const auto *rule : simplFuncs.getRules(lhs->getTypeId(), rhs->getTypeId())) {
+    if (auto res = rule->function(*func, lhs, rhs)) {
       return res;
     }
   }
@@ -61,96 +65,122 @@ ArgumentPtr IPolynomExpression::useSimplifyFunctions(const SimplifyFunctionsVect
 }
 
 ArgumentPtr IPolynomExpression::preSimplify() const {
-  auto simpl = cast<IPolynomExpression>(clone());
-
-  simpl->simplifyChildren(false);
-  simpl->simplifyRec(false);
+  std::shared_ptr<IPolynomExpression> simpl = simplifyChildren(false);
+  simplifyNeighbors(simpl, false);
 
-  if (simpl->children.size() == 1) {
-    return simpl->children.front();
+  if (const auto &simplChildren = simpl ? simpl->children : children; simplChildren.size() == 1) {
+    return simplChildren.front();
   }
 
   return simpl;
 }
 
 ArgumentPtr IPolynomExpression::postSimplify() const {
-  auto simpl = cast<IPolynomExpression>(clone());
+  std::shared_ptr<IPolynomExpression> simpl = simplifyChildren(true);
+  simplifyNeighbors(simpl, true);
 
-  simpl->simplifyChildren(true);
-  simpl->simplifyRec(true);
-
-  if (simpl->children.size() == 1) {
-    return simpl->children.front();
+  if (const auto &simplChildren = simpl ? simpl->children : children; simplChildren.size() == 1) {
+    return simplChildren.front();
   }
 
   return simpl;
 }
 
-void IPolynomExpression::simplifyRec(bool isPostSimplify) {
-  sort();
+void IPolynomExpression::simplifyNeighbors(std::shared_ptr<IPolynomExpression> &simpl, bool isPostSimplify) const {
+  if (!simpl && !isSorted()) {
+    simpl = cast<IPolynomExpression>(clone());
+  }
 
-  bool isSimplified = true;
+  if (simpl) {
+    simpl->sort();
+  }
 
-  for (size_t i = 1; i < children.size(); i++) {
-    const ArgumentPtr &lhs = children[i - 1];
-    const ArgumentPtr &rhs = children[i];
+  // Rules depend only on the neighbors, so a pair that was not simplified is skipped on the next passes.
+  // The pairs are kept alive, so their addresses are not reused by new children
+  std::set<std::pair<ArgumentPtr, ArgumentPtr>> inertNeighbors;
 
-    if (is<Undefined>(lhs) || is<Undefined>(rhs)) {
-      children = {Undefined().clone()};
-      break;
-    }
+  for (bool isSimplified = false; !isSimplified;) {
+    isSimplified = true;
 
-    ArgumentPtr res;
-    bool isResSimplified = false;
+    for (size_t i = 1; i < (simpl ? simpl->children : children).size(); i++) {
+      const IPolynomExpression &current = simpl ? *simpl : *this;
+      const ArgumentPtr &lhs = current.children[i - 1];
+      const ArgumentPtr &rhs = current.children[i];
 
-    if (isPostSimplify) {
-      res = callFunction(*func, {lhs, rhs});
-      isResSimplified = res != nullptr;
-    }
+      if (is<Undefined>(lhs) || is<Undefined>(rhs)) {
+        if (!simpl) {
+          simpl = cast<IPolynomExpression>(clone());
+        }
 
-    if (!res) {
-      res = isPostSimplify ? useSimplifyFunctions(getFunctionsForPostSimplify(), i - 1, i)
-                           : useSimplifyFunctions(getFunctionsForPreSimplify(), i - 1, i);
-    }
+        simpl->children = {Undefined().clone()};
+        break;
+      }
 
-    if (!res) {
-      continue;
-    }
+      if (inertNeighbors.count({lhs, rhs}) != 0) {
+        continue;
+      }
 
-    if (!isResSimplified) {
-      ArgumentPtr prevExpr = makeExpr(*getFunction(), lhs, rhs);
+      ArgumentPtr res = simplifyNeighbors(lhs, rhs, isPostSimplify);
 
-      if (isPostSimplify) {
-        postSimplifyChild(res);
-      }
-      else {
-        preSimplifyChild(res);
+      if (!res) {
+        inertNeighbors.emplace(lhs, rhs);
+        continue;
       }
 
-      if (*prevExpr == *res) {
-        continue;
+      if (!simpl) {
+        simpl = cast<IPolynomExpression>(clone());
       }
+
+      simpl->children.erase(simpl->children.begin() + ArgumentsPtrVector::difference_type(i - 1));
+      simpl->children.erase(simpl->children.begin() + ArgumentsPtrVector::difference_type(i - 1));
+      simpl->addElement(res);
+
+      i--;
+      isSimplified = false;
+    }
+
+    if (!isSimplified) {
+      simpl->sort();
     }
+  }
+}
+
+ArgumentPtr IPolynomExpression::simplifyNeighbors(const ArgumentPtr &lhs, const ArgumentPtr &rhs, bool isPostSimplify) const {
+  if (isPostSimplify) {
+    if (ArgumentPtr res = callFunction(*func, {lhs, rhs})) {
+      return res;
+    }
+  }
+
+  ArgumentPtr res = isPostSimplify ? useSimplifyFunctions(getFunctionsForPostSimplify(), lhs, rhs)
+                                   : useSimplifyFunctions(getFunctionsForPreSimplify(), lhs, rhs);
+
+  if (!res) {
+    return {};
+  }
 
-    children.erase(children.begin() + ArgumentsPtrVector::difference_type(i - 1));
-    children.erase(children.begin() + ArgumentsPtrVector::difference_type(i - 1));
-    addElement(res);
+  ArgumentPtr prevExpr = makeExpr(*func, lhs, rhs);
 
-    i--;
-    isSimplified = false;
+  if (isPostSimplify) {
+    postSimplifyChild(res);
+  }
+  else {
+    preSimplifyChild(res);
   }
 
-  if (!isSimplified) {
-    simplifyRec(isPostSimplify);
+  if (*prevExpr == *res) {
+    return {};
   }
+
+  return res;
 }
 
-void IPolynomExpression::simplifyChildren(bool isPostSimplify) {
-  ArgumentsPtrVector oldChildren = children;
+std::shared_ptr<IPolynomExpression> IPolynomExpression::simplifyChildren(bool isPostSimplify) const {
+  std::shared_ptr<IPolynomExpression> simpl;
 
-  children.clear();
+  for (size_t i = 0; i < children.size(); i++) {
+    ArgumentPtr child = children[i];
 
-  for (auto &child : oldChildren) {
     if (isPostSimplify) {
       postSimplifyChild(child);
     }
@@ -158,16 +188,63 @@ void IPolynomExpression::simplifyChildren(bool isPostSimplify) {
       preSimplifyChild(child);
     }
 
-    addElement(child);
+    if (!simpl) {
+      if (child == children[i] && isFlatChild(child)) {
+        continue;
+      }
+
+      // The first changed child, the unchanged ones before it are kept as they are
+      simpl = cast<IPolynomExpression>(clone());
+      simpl->children.resize(i);
+    }
+
+    simpl->addElement(child);
   }
+
+  return simpl;
 }
 
-IPolynomExpression::SimplifyFunctionsVector IPolynomExpression::getFunctionsForPreSimplify() const {
-  return {};
+bool IPolynomExpression::isFlatChild(const ArgumentPtr &child) const {
+  const auto childExpr = cast<IExpression>(child);
+  return !childExpr || (childExpr->getFunction() && childExpr->getTypeId() != getTypeId());
 }
 
-IPolynomExpression::SimplifyFunctionsVector IPolynomExpression::getFunctionsForPostSimplify() const {
-  return {};
+IPolynomExpression::SimplifyFunctionsVector::SimplifyFunctionsVector(std::initializer_list<SimplifyRule> inRules)
+    : rules(inRules) {
+}
+
+const std::vector<const IPolynomExpression::SimplifyRule *> &
+IPolynomExpression::SimplifyFunctionsVector::getRules(MathObjectTypeId lhsTypeId, MathObjectTypeId rhsTypeId) const {
+  const std::pair key(lhsTypeId, rhsTypeId);
+
+  {
+    std::shared_lock lock(mutex);
+
+    if (auto iter = rulesIndex.find(key); iter != rulesIndex.end()) {
+      return iter->second;
+    }
+  }
+
+  std::vector<const SimplifyRule *> keyRules;
+
+  for (const auto &rule : rules) {
+    if (isBaseOf(rule.lhsTypeId, lhsTypeId) && isBaseOf(rule.rhsTypeId, rhsTypeId)) {
+      keyRules.emplace_back(&rule);
+    }
+  }
+
+  std::unique_lock lock(mutex);
+  return rulesIndex.try_emplace(key, std::move(keyRules)).first->second;
+}
+
+const IPolynomExpression::SimplifyFunctionsVector &IPolynomExpression::getFunctionsForPreSimplify() const {
+  static const SimplifyFunctionsVector simplifyFunctions = {};
+  return simplifyFunctions;
+}
+
+const IPolynomExpression::SimplifyFunctionsVector &IPolynomExpression::getFunctionsForPostSimplify() const {
+  static const SimplifyFunctionsVector simplifyFunctions = {};
+  return simplifyFunctions;
 }
 
 ArgumentPtr IPolynomExpression::preciseSimplify() const {
@@ -212,14 +289,26 @@ void IPolynomExpression::setChildren(const ArgumentsPtrVector &childVect) {
   }
 
   children = childVect;
+  resetSubtreeHash();
 }
 
-void IPolynomExpression::sort() {
-  std::stable_sort(children.begin(), children.end(), [this](const ArgumentPtr &lhs, const ArgumentPtr &rhs) {
+bool IPolynomExpression::isSorted() const {
+  return std::is_sorted(children.begin(), children.end(), [this](const ArgumentPtr &lhs, const ArgumentPtr &rhs) {
     return comparator(lhs, rhs) < 0;
   });
 }
 
+void IPolynomExpression::sort() {
+  auto comp = [this](const ArgumentPtr &lhs, const ArgumentPtr &rhs) {
+    return comparator(lhs, rhs) < 0;
+  };
+
+  // Usually only the children added by the last simplification pass are out of order
+  auto sortedEnd = std::is_sorted_until(children.begin(), children.end(), comp);
+  std::stable_sort(sortedEnd, children.end(), comp);
+  std::inplace_merge(children.begin(), sortedEnd, children.end(), comp);
+}
+
 int IPolynomExpression::comparator(const ArgumentPtr &lhs, const ArgumentPtr &rhs) const {
   auto lhsExpr = cast<IExpression>(lhs);
   auto rhsExpr = cast<IExpression>(rhs);
@@ -35,23 +35,30 @@ IUnaryExpression::SimplifyFunctionsVector IUnaryExpression::getFunctionsForPostS
 }
 
 ArgumentPtr IUnaryExpression::simplify() const {
-  ArgumentPtr simpl = cast<IUnaryExpression>(clone());
-  preSimplifyChild(simpl);
+  ArgumentPtr simpl = preSimplify();
+
+  if (!simpl) {
+    return postSimplify();
+  }
+
   postSimplifyChild(simpl);
   return simpl;
 }
 
 ArgumentPtr IUnaryExpression::preSimplify() const {
-  auto simpl = cast<IUnaryExpression>(clone());
-  preSimplifyChild(simpl->child);
+  ArgumentPtr simplChild = child;
+  preSimplifyChild(simplChild);
 
-  if (is<Undefined>(simpl->child)) {
+  if (is<Undefined>(simplChild)) {
     return Undefined().clone();
   }
 
-  ArgumentPtr res = simpl->useSimplifyFunctions(getFunctionsForPreSimplify());
+  std::shared_ptr<IUnaryExpression> simpl = copyIfChanged(simplChild);
+  const IUnaryExpression &current = simpl ? *simpl : *this;
 
-  if (res && *res != *simpl) {
+  ArgumentPtr res = current.useSimplifyFunctions(getFunctionsForPreSimplify());
+
+  if (res && *res != current) {
     preSimplifyChild(res);
     return res;
   }
@@ -60,20 +67,23 @@ ArgumentPtr IUnaryExpression::preSimplify() const {
 }
 
 ArgumentPtr IUnaryExpression::postSimplify() const {
-  auto simpl = cast<IUnaryExpression>(clone());
-  postSimplifyChild(simpl->child);
+  ArgumentPtr simplChild = child;
+  postSimplifyChild(simplChild);
 
-  if (is<Undefined>(simpl->child)) {
+  if (is<Undefined>(simplChild)) {
     return Undefined().clone();
   }
 
-  if (ArgumentPtr res = callFunction(*simpl->func, {simpl->child})) {
+  if (ArgumentPtr res = callFunction(*func, {simplChild})) {
     return res;
   }
 
-  ArgumentPtr res = simpl->useSimplifyFunctions(getFunctionsForPostSimplify());
+  std::shared_ptr<IUnaryExpression> simpl = copyIfChanged(simplChild);
+  const IUnaryExpression &current = simpl ? *simpl : *this;
+
+  ArgumentPtr res = current.useSimplifyFunctions(getFunctionsForPostSimplify());
 
-  if (res && *res != *simpl) {
+  if (res && *res != current) {
     postSimplifyChild(res);
     return res;
   }
@@ -97,12 +107,23 @@ ArgumentPtr IUnaryExpression::useSimplifyFunctions(const SimplifyFunctionsVector
   return {};
 }
 
+std::shared_ptr<IUnaryExpression> IUnaryExpression::copyIfChanged(const ArgumentPtr &simplChild) const {
+  if (simplChild == child) {
+    return {};
+  }
+
+  auto simpl = cast<IUnaryExpression>(clone());
+  simpl->child = simplChild;
+  return simpl;
+}
+
 void IUnaryExpression::setChildren(const ArgumentsPtrVector &childVect) {
   if (childVect.size() != 1) {
     throw InvalidInputFunctionException(toString(), argumentVectorToStringVector(childVect));
   }
 
   child = childVect.front();
+  resetSubtreeHash();
 }
 
 }
\ No newline at end of file
@@ -73,24 +73,24 @@ int AddExpression::comparator(const ArgumentPtr &lhs, const ArgumentPtr &rhs) co
   return IPolynomExpression::comparator(lhs, rhs);
 }
 
-AddExpression::SimplifyFunctionsVector AddExpression::getFunctionsForPreSimplify() const {
+const AddExpression::SimplifyFunctionsVector &AddExpression::getFunctionsForPreSimplify() const {
   static const AddExpression::SimplifyFunctionsVector simplifyFunctions = {
       &AddExpression::callFunctionSimplify,
       &AddExpression::sumSimplify,
       &AddExpression::constSimplify,
       &AddExpression::powSimplify,
-      &AddExpression::logSimplify,
-      &AddExpression::mulLogSimplify,
+      {&AddExpression::logSimplify, IExpression::getTypeIdStatic(), IExpression::getTypeIdStatic()},
+      {&AddExpression::mulLogSimplify, IExpression::getTypeIdStatic(), IExpression::getTypeIdStatic()},
   };
   return simplifyFunctions;
 }
 
-AddExpression::SimplifyFunctionsVector AddExpression::getFunctionsForPostSimplify() const {
+const AddExpression::SimplifyFunctionsVector &AddExpression::getFunctionsForPostSimplify() const {
   static const AddExpression::SimplifyFunctionsVector simplifyFunctions = {
       &AddExpression::constSimplify,
       &AddExpression::powSimplify,
-      &AddExpression::logSimplify,
-      &AddExpression::mulLogSimplify,
+      {&AddExpression::logSimplify, IExpression::getTypeIdStatic(), IExpression::getTypeIdStatic()},
+      {&AddExpression::mulLogSimplify, IExpression::getTypeIdStatic(), IExpression::getTypeIdStatic()},
   };
   return simplifyFunctions;
 }
@@ -13,9 +13,9 @@ public:
   }
 
 protected:
-  SimplifyFunctionsVector getFunctionsForPreSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPreSimplify() const override;
 
-  SimplifyFunctionsVector getFunctionsForPostSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPostSimplify() const override;
 
   std::string operatorChildToString(const ArgumentPtr &inChild, const ArgumentPtr &prevChild) const override;
 
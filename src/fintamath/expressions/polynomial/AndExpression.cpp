@@ -11,21 +11,21 @@ AndExpression::AndExpression(const ArgumentsPtrVector &inChildren)
     : IPolynomExpressionCRTP(And(), inChildren) {
 }
 
-AndExpression::SimplifyFunctionsVector AndExpression::getFunctionsForPreSimplify() const {
+const AndExpression::SimplifyFunctionsVector &AndExpression::getFunctionsForPreSimplify() const {
   static const AndExpression::SimplifyFunctionsVector simplifyFunctions = {
       &AndExpression::boolSimplify,
       &AndExpression::equalSimplify,
-      &AndExpression::notSimplify,
+      {&AndExpression::notSimplify, IMathObject::getTypeIdStatic(), IExpression::getTypeIdStatic()},
   };
   return simplifyFunctions;
 }
 
-AndExpression::SimplifyFunctionsVector AndExpression::getFunctionsForPostSimplify() const {
+const AndExpression::SimplifyFunctionsVector &AndExpression::getFunctionsForPostSimplify() const {
   static const AndExpression::SimplifyFunctionsVector simplifyFunctions = {
       &AndExpression::orSimplify,
       &AndExpression::boolSimplify,
       &AndExpression::equalSimplify,
-      &AndExpression::notSimplify,
+      {&AndExpression::notSimplify, IMathObject::getTypeIdStatic(), IExpression::getTypeIdStatic()},
   };
   return simplifyFunctions;
 }
@@ -13,9 +13,9 @@ public:
   }
 
 protected:
-  SimplifyFunctionsVector getFunctionsForPreSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPreSimplify() const override;
 
-  SimplifyFunctionsVector getFunctionsForPostSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPostSimplify() const override;
 
   bool isComparableOrderInversed() const override;
 
@@ -59,18 +59,18 @@ std::string MulExpression::operatorChildToString(const ArgumentPtr &inChild, con
   return (prevChild && *prevChild != Integer(-1) ? " " : "") + inChild->toString();
 }
 
-MulExpression::SimplifyFunctionsVector MulExpression::getFunctionsForPreSimplify() const {
+const MulExpression::SimplifyFunctionsVector &MulExpression::getFunctionsForPreSimplify() const {
   static const MulExpression::SimplifyFunctionsVector simplifyFunctions = {
       &MulExpression::constSimplify,
       &MulExpression::callFunctionSimplify,
-      &MulExpression::rationalSimplify,
+      {&MulExpression::rationalSimplify, Rational::getTypeIdStatic()},
       &MulExpression::divSimplify,
       &MulExpression::powSimplify,
   };
   return simplifyFunctions;
 }
 
-MulExpression::SimplifyFunctionsVector MulExpression::getFunctionsForPostSimplify() const {
+const MulExpression::SimplifyFunctionsVector &MulExpression::getFunctionsForPostSimplify() const {
   static const MulExpression::SimplifyFunctionsVector simplifyFunctions = {
       &MulExpression::constSimplify,
       &MulExpression::polynomSimplify,
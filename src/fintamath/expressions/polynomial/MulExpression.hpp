@@ -16,9 +16,9 @@ public:
 protected:
   std::string operatorChildToString(const ArgumentPtr &inChild, const ArgumentPtr &prevChild) const override;
 
-  SimplifyFunctionsVector getFunctionsForPreSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPreSimplify() const override;
 
-  SimplifyFunctionsVector getFunctionsForPostSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPostSimplify() const override;
 
   bool isTermsOrderInversed() const override;
 
@@ -4,6 +4,7 @@
 #include "fintamath/functions/logic/And.hpp"
 #include "fintamath/functions/logic/Not.hpp"
 #include "fintamath/functions/logic/Or.hpp"
+#include "fintamath/numbers/INumber.hpp"
 
 namespace fintamath {
 
@@ -25,7 +26,7 @@ std::string OrExpression::operatorChildToString(const ArgumentPtr &inChild, cons
 
 ArgumentPtr OrExpression::postSimplify() const {
   auto simplObj = IPolynomExpression::postSimplify();
-  auto simpl = cast<OrExpression>(simplObj);
+  const auto *simpl = simplObj ? cast<OrExpression>(simplObj.get()) : this;
 
   if (!simpl) {
     return simplObj;
@@ -34,11 +35,43 @@ ArgumentPtr OrExpression::postSimplify() const {
   auto simplChildren = simpl->children;
   auto simplChildrenSizeInitial = simplChildren.size();
 
+  std::vector<ArgumentsPtrVector> simplChildrenConjuncts;
+  std::vector<uint64_t> simplChildrenMasks;
+
+  for (const auto &child : simplChildren) {
+    simplChildrenConjuncts.emplace_back(getConjuncts(child));
+    simplChildrenMasks.emplace_back(getConjunctsMask(simplChildrenConjuncts.back()));
+  }
+
   for (size_t i = 0; i + 1 < simplChildren.size(); i++) {
     for (size_t j = i + 1; j < simplChildren.size(); j++) {
-      if (auto res = absorptionSimplify(simplChildren[i], simplChildren[j])) {
+      const ArgumentsPtrVector &lhsConjuncts = simplChildrenConjuncts[i];
+      const ArgumentsPtrVector &rhsConjuncts = simplChildrenConjuncts[j];
+
+      if (lhsConjuncts.size() == rhsConjuncts.size()) {
+        continue;
+      }
+
+      bool isLhsAbsorbing = lhsConjuncts.size() < rhsConjuncts.size();
+      uint64_t minMask = isLhsAbsorbing ? simplChildrenMasks[i] : simplChildrenMasks[j];
+      uint64_t maxMask = isLhsAbsorbing ? simplChildrenMasks[j] : simplChildrenMasks[i];
+
+      // Some conjunct of the shorter child is surely missing from the longer one
+      if ((minMask & ~maxMask) != 0) {
+        continue;
+      }
+
+      if (auto res = absorptionSimplify(lhsConjuncts, rhsConjuncts)) {
         simplChildren[i] = res;
+
+        if (!isLhsAbsorbing) {
+          simplChildrenConjuncts[i] = std::move(simplChildrenConjuncts[j]);
+          simplChildrenMasks[i] = simplChildrenMasks[j];
+        }
+
         simplChildren.erase(simplChildren.begin() + ArgumentsPtrVector::difference_type(j));
+        simplChildrenConjuncts.erase(simplChildrenConjuncts.begin() + std::vector<ArgumentsPtrVector>::difference_type(j));
+        simplChildrenMasks.erase(simplChildrenMasks.begin() + std::vector<uint64_t>::difference_type(j));
         break;
       }
     }
@@ -54,22 +87,22 @@ ArgumentPtr OrExpression::postSimplify() const {
     return simplChildren.front();
   }
 
-  return simpl;
+  return simplObj;
 }
 
-OrExpression::SimplifyFunctionsVector OrExpression::getFunctionsForPreSimplify() const {
+const OrExpression::SimplifyFunctionsVector &OrExpression::getFunctionsForPreSimplify() const {
   static const OrExpression::SimplifyFunctionsVector simplifyFunctions = {
-      &OrExpression::notSimplify,
+      {&OrExpression::notSimplify, IMathObject::getTypeIdStatic(), IExpression::getTypeIdStatic()},
       &OrExpression::boolSimplify,
       &OrExpression::equalSimplify,
   };
   return simplifyFunctions;
 }
 
-OrExpression::SimplifyFunctionsVector OrExpression::getFunctionsForPostSimplify() const {
+const OrExpression::SimplifyFunctionsVector &OrExpression::getFunctionsForPostSimplify() const {
   static const OrExpression::SimplifyFunctionsVector simplifyFunctions = {
-      &OrExpression::andSimplify,
-      &OrExpression::notSimplify,
+      {&OrExpression::andSimplify, IExpression::getTypeIdStatic(), IExpression::getTypeIdStatic()},
+      {&OrExpression::notSimplify, IMathObject::getTypeIdStatic(), IExpression::getTypeIdStatic()},
       &OrExpression::boolSimplify,
       &OrExpression::equalSimplify,
   };
@@ -181,36 +214,43 @@ ArgumentPtr OrExpression::andSimplify(const IFunction & /*func*/, const Argument
   return resultChildren.front();
 }
 
-ArgumentPtr OrExpression::absorptionSimplify(const ArgumentPtr &lhsChild, const ArgumentPtr &rhsChild) {
-  ArgumentPtr lhs = lhsChild;
-  ArgumentPtr rhs = rhsChild;
+ArgumentsPtrVector OrExpression::getConjuncts(const ArgumentPtr &child) {
+  if (const auto childExpr = cast<IExpression>(child); childExpr && is<And>(childExpr->getFunction())) {
+    return childExpr->getChildren();
+  }
 
-  std::shared_ptr<const IExpression> lhsExpr = cast<IExpression>(lhs);
-  std::shared_ptr<const IExpression> rhsExpr = cast<IExpression>(rhs);
+  return {child};
+}
 
-  ArgumentsPtrVector lhsChildren;
-  ArgumentsPtrVector rhsChildren;
+uint64_t OrExpression::getConjunctsMask(const ArgumentsPtrVector &conjuncts) {
+  uint64_t mask = 0;
 
-  if (lhsExpr && is<And>(lhsExpr->getFunction())) {
-    lhsChildren = lhsExpr->getChildren();
-  }
-  else {
-    lhsChildren.emplace_back(lhs);
-  }
+  for (const auto &conjunct : conjuncts) {
+    // Equal conjuncts must get equal bits, numbers of different types may be equal so they share one
+    size_t key = 0;
 
-  if (rhsExpr && is<And>(rhsExpr->getFunction())) {
-    rhsChildren = rhsExpr->getChildren();
-  }
-  else {
-    rhsChildren.emplace_back(rhs);
+    if (const auto conjunctExpr = cast<IExpression>(conjunct)) {
+      if (const auto conjunctFunc = conjunctExpr->getFunction()) {
+        key = conjunctFunc->getTypeId();
+      }
+    }
+    else if (!is<INumber>(conjunct)) {
+      key = conjunct->getTypeId() ^ conjunct->hash();
+    }
+
+    mask |= uint64_t(1) << (key % 64);
   }
 
+  return mask;
+}
+
+ArgumentPtr OrExpression::absorptionSimplify(const ArgumentsPtrVector &lhsChildren, const ArgumentsPtrVector &rhsChildren) {
   if (lhsChildren.size() == rhsChildren.size()) {
     return {};
   }
 
-  ArgumentsPtrVector maxChildren = lhsChildren.size() > rhsChildren.size() ? lhsChildren : rhsChildren;
-  ArgumentsPtrVector minChildren = lhsChildren.size() < rhsChildren.size() ? lhsChildren : rhsChildren;
+  const ArgumentsPtrVector &maxChildren = lhsChildren.size() > rhsChildren.size() ? lhsChildren : rhsChildren;
+  const ArgumentsPtrVector &minChildren = lhsChildren.size() < rhsChildren.size() ? lhsChildren : rhsChildren;
   size_t matchCount = 0;
 
   for (size_t i = 0, j = 0; i < maxChildren.size() && j < minChildren.size(); i++) {
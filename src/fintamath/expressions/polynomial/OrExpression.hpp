@@ -17,9 +17,9 @@ protected:
 
   ArgumentPtr postSimplify() const override;
 
-  SimplifyFunctionsVector getFunctionsForPreSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPreSimplify() const override;
 
-  SimplifyFunctionsVector getFunctionsForPostSimplify() const override;
+  const SimplifyFunctionsVector &getFunctionsForPostSimplify() const override;
 
   bool isComparableOrderInversed() const override;
 
@@ -32,7 +32,11 @@ private:
 
   static ArgumentPtr andSimplify(const IFunction &func, const ArgumentPtr &lhsChild, const ArgumentPtr &rhsChild);
 
-  static ArgumentPtr absorptionSimplify(const ArgumentPtr &lhsChild, const ArgumentPtr &rhsChild);
+  static ArgumentPtr absorptionSimplify(const ArgumentsPtrVector &lhsChildren, const ArgumentsPtrVector &rhsChildren);
+
+  static ArgumentsPtrVector getConjuncts(const ArgumentPtr &child);
+
+  static uint64_t getConjunctsMask(const ArgumentsPtrVector &conjuncts);
 };
 
 }
\ No newline at end of file
@@ -15,7 +15,7 @@
 
 namespace fintamath {
 
-using TrigonometryFunctionsTable = std::map<std::string, std::function<ArgumentPtr(const Rational &)>>;
+using TrigonometryFunctionsTable = std::unordered_map<MathObjectTypeId, std::function<ArgumentPtr(const Rational &)>>;
 
 using TrigonometryTable = std::map<Rational, ArgumentPtr>;
 
@@ -66,12 +66,12 @@ ArgumentPtr InvTrigExpression::constSimplify(const IFunction &func, const Argume
 
 ArgumentPtr InvTrigExpression::trigTableSimplify(const IFunction &func, const Rational &rhs) {
   static const TrigonometryFunctionsTable trigTable = {
-      {Asin().toString(), &trigTableAsinSimplify},
-      {Acos().toString(), &trigTableAcosSimplify},
-      {Atan().toString(), &trigTableAtanSimplify},
-      {Acot().toString(), &trigTableAcotSimplify},
+      {Asin::getTypeIdStatic(), &trigTableAsinSimplify},
+      {Acos::getTypeIdStatic(), &trigTableAcosSimplify},
+      {Atan::getTypeIdStatic(), &trigTableAtanSimplify},
+      {Acot::getTypeIdStatic(), &trigTableAcotSimplify},
   };
-  return trigTable.at(func.toString())(rhs);
+  return trigTable.at(func.getTypeId())(rhs);
 }
 
 ArgumentPtr InvTrigExpression::trigTableAsinSimplify(const Rational &rhs) {
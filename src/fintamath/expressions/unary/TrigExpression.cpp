@@ -16,7 +16,7 @@
 
 namespace fintamath {
 
-using TrigonometryFunctionsTable = std::map<std::string, std::function<ArgumentPtr(const Rational &)>>;
+using TrigonometryFunctionsTable = std::unordered_map<MathObjectTypeId, std::function<ArgumentPtr(const Rational &)>>;
 
 using TrigonometryTable = std::map<Rational, ArgumentPtr>;
 
@@ -82,13 +82,13 @@ ArgumentPtr TrigExpression::constSimplify(const IFunction &func, const ArgumentP
 
 ArgumentPtr TrigExpression::trigTableSimplify(const IFunction &func, const Rational &rhs) {
   static const TrigonometryFunctionsTable trigTable = {
-      {Sin().toString(), &trigTableSinSimplify},
-      {Cos().toString(), &trigTableCosSimplify},
-      {Tan().toString(), &trigTableTanSimplify},
-      {Cot().toString(), &trigTableCotSimplify},
+      {Sin::getTypeIdStatic(), &trigTableSinSimplify},
+      {Cos::getTypeIdStatic(), &trigTableCosSimplify},
+      {Tan::getTypeIdStatic(), &trigTableTanSimplify},
+      {Cot::getTypeIdStatic(), &trigTableCotSimplify},
   };
   Rational rhsShifted = phaseShiftPeriod(rhs);
-  return trigTable.at(func.toString())(rhsShifted);
+  return trigTable.at(func.getTypeId())(rhsShifted);
 }
 
 ArgumentPtr TrigExpression::trigTableSinSimplify(const Rational &rhs) {
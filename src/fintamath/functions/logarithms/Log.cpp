@@ -6,6 +6,7 @@
 #include "fintamath/literals/constants/Inf.hpp"
 #include "fintamath/literals/constants/NegInf.hpp"
 #include "fintamath/literals/constants/Undefined.hpp"
+#include "fintamath/numbers/IntegerFunctions.hpp"
 #include "fintamath/numbers/RealFunctions.hpp"
 
 namespace fintamath {
@@ -103,20 +104,16 @@ std::unique_ptr<IMathObject> Log::logSimplify(const Integer &lhs, const Integer
 
 std::unique_ptr<IMathObject> Log::logSimplify(const Rational &lhs, const Rational &rhs) {
   const bool isResInverted = lhs > rhs;
-  const Rational divider = isResInverted ? rhs : lhs;
-  Rational remainder = isResInverted ? lhs : rhs;
-  Rational res = 0;
+  const Rational &base = isResInverted ? rhs : lhs;
+  const Rational &power = isResInverted ? lhs : rhs;
 
-  while (remainder > divider) {
-    res += 1;
-    remainder /= divider;
-  }
-
-  if (remainder == divider) {
-    res += 1;
+  // Powers of a reduced fraction are reduced, so both the numerator and the denominator have to be exact powers
+  Integer remainder;
+  Integer res = log(base.numerator(), power.numerator(), remainder);
 
+  if (remainder == 0 && pow(base.denominator(), res) == power.denominator()) {
     if (isResInverted) {
-      return (Rational(1) / res).toMinimalObject();
+      return Rational(1, res).toMinimalObject();
     }
 
     return res.toMinimalObject();
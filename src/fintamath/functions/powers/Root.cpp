@@ -1,5 +1,7 @@
 #include "fintamath/functions/powers/Root.hpp"
 
+#include <atomic>
+
 #include "fintamath/functions/arithmetic/Add.hpp"
 #include "fintamath/functions/arithmetic/Div.hpp"
 #include "fintamath/functions/arithmetic/Mul.hpp"
@@ -12,6 +14,15 @@
 
 namespace fintamath {
 
+namespace {
+
+std::atomic<size_t> &getFactorsMaxWorkRef() {
+  static std::atomic<size_t> maxWork = 1 << 24;
+  return maxWork;
+}
+
+}
+
 std::unique_ptr<IMathObject> Root::call(const ArgumentsRefVector &argsVect) const {
   const auto &lhs = cast<INumber>(argsVect.front().get());
   const auto &rhs = cast<INumber>(argsVect.back().get());
@@ -63,9 +74,18 @@ std::unique_ptr<IMathObject> Root::rootSimplify(const Integer &lhs, const Intege
     return res;
   }
 
+  // Perfect roots of 0 and 1 are handled above, so lhs is greater than 1
+  Integer exponent;
+  Integer base = perfectPower(lhs, exponent);
+
+  // root(base^exponent, rhs) = base^(exponent / rhs) root(base^(exponent % rhs), rhs), the root can be reduced by a common divisor
+  Integer rootExponent = exponent % rhs;
+  Integer rootGcd = gcd(rootExponent, rhs);
+
   ArgumentsPtrVector mulChildren;
 
-  std::map<Integer, Integer> rootFactors = roots(lhs, rhs);
+  std::map<Integer, Integer> rootFactors = roots(pow(base, rootExponent / rootGcd), rhs / rootGcd);
+  rootFactors.begin()->second *= pow(base, exponent / rhs);
 
   if (rootFactors.begin()->first == 1) {
     if (rootFactors.begin()->second != 1) {
@@ -89,10 +109,8 @@ std::unique_ptr<IMathObject> Root::rootSimplify(const Integer &lhs, const Intege
 }
 
 std::map<Integer, Integer> Root::roots(const Integer &lhs, const Integer &rhs) {
-  static Integer factorLimit = pow(Integer(2), 15);
-
   std::map<Integer, Integer> rootFactors{{1, 1}};
-  std::map<Integer, Integer> factorRates = factors(lhs, factorLimit);
+  std::map<Integer, Integer> factorRates = factorsWithBudget(lhs, getFactorsMaxWork());
 
   for (const auto &factorRate : factorRates) {
     Rational power(factorRate.second, rhs);
@@ -125,13 +143,11 @@ std::unique_ptr<IMathObject> Root::perfectRoot(const Integer &lhs, const Integer
     return lhs.clone();
   }
 
-  if (rhs == 2) { // TODO: implement perfect nth-roots minimization
-    Integer remainder;
-    Integer lhsSqrt = sqrt(lhs, remainder);
+  Integer remainder;
+  Integer lhsRoot = root(lhs, rhs, remainder);
 
-    if (remainder == 0) {
-      return lhsSqrt.clone();
-    }
+  if (remainder == 0) {
+    return lhsRoot.clone();
   }
 
   return {};
@@ -224,4 +240,12 @@ std::unique_ptr<IMathObject> Root::rootSimplify(const Real &lhs, const Integer &
   return Pow()(lhs, Rational(1, rhs));
 }
 
+void Root::setFactorsMaxWork(size_t maxWork) {
+  getFactorsMaxWorkRef() = maxWork;
+}
+
+size_t Root::getFactorsMaxWork() {
+  return getFactorsMaxWorkRef();
+}
+
 }
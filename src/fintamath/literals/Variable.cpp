@@ -32,4 +32,13 @@ std::string Variable::toString() const {
   return name + (index != -1 ? "_" + index.toString() : "");
 }
 
+size_t Variable::hash() const {
+  size_t res = std::hash<char>{}(name.front());
+  return res ^ (index.hash() + 0x9e3779b97f4a7c15ULL + (res << 6) + (res >> 2));
+}
+
+bool Variable::equals(const Variable &rhs) const {
+  return name == rhs.name && index == rhs.index;
+}
+
 }
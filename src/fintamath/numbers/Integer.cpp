@@ -1,16 +1,68 @@
 #include "fintamath/numbers/Integer.hpp"
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
 #include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/IntegerArithmetic.hpp"
 
 using namespace boost::multiprecision;
 
 namespace fintamath {
 
+namespace {
+
+bool addOverflow(int64_t lhs, int64_t rhs, int64_t &res) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_add_overflow(lhs, rhs, &res);
+#else
+  if ((rhs > 0 && lhs > std::numeric_limits<int64_t>::max() - rhs) ||
+      (rhs < 0 && lhs < std::numeric_limits<int64_t>::min() - rhs)) {
+    return true;
+  }
+
+  res = lhs + rhs;
+  return false;
+#endif
+}
+
+bool subOverflow(int64_t lhs, int64_t rhs, int64_t &res) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_sub_overflow(lhs, rhs, &res);
+#else
+  if ((rhs < 0 && lhs > std::numeric_limits<int64_t>::max() + rhs) ||
+      (rhs > 0 && lhs < std::numeric_limits<int64_t>::min() + rhs)) {
+    return true;
+  }
+
+  res = lhs - rhs;
+  return false;
+#endif
+}
+
+bool mulOverflow(int64_t lhs, int64_t rhs, int64_t &res) {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_mul_overflow(lhs, rhs, &res);
+#else
+  constexpr int64_t min = std::numeric_limits<int64_t>::min();
+  constexpr int64_t max = std::numeric_limits<int64_t>::max();
+
+  if (lhs > 0 ? (rhs > 0 ? lhs > max / rhs : rhs < min / lhs)
+              : (rhs > 0 ? lhs < min / rhs : lhs != 0 && rhs < max / lhs)) {
+    return true;
+  }
+
+  res = lhs * rhs;
+  return false;
+#endif
+}
+
+}
+
 Integer::Integer() = default;
 
 Integer::Integer(const Integer &rhs) = default;
@@ -23,74 +75,209 @@ Integer &Integer::operator=(Integer &&rhs) noexcept = default;
 
 Integer::~Integer() = default;
 
-Integer::Integer(cpp_int inBackend) : backend(std::move(inBackend)) {
+Integer::Integer(cpp_int inBackend) : backend(std::move(inBackend)), isSmallBackend(false) {
+  normalize();
 }
 
 Integer::Integer(std::string str) {
-  if (str.empty()) {
+  std::optional<Integer> res = tryParse(str);
+
+  if (!res) {
     throw InvalidInputException(str);
   }
 
-  // Remove leading zeros
-  {
-    size_t i = 0;
-    if (str.front() == '-') {
-      i++;
-    }
+  *this = std::move(*res);
+}
 
-    str.erase(i, str.find_first_not_of('0'));
-    if (str.empty()) {
-      str = "0";
-    }
+Integer::Integer(int64_t val) : smallBackend(val) {
+}
+
+std::string Integer::toString() const {
+  if (isSmallBackend) {
+    return std::to_string(smallBackend);
   }
 
-  try {
-    backend.assign(str);
+  return backendToString(backend);
+}
+
+int Integer::sign() const {
+  if (isSmallBackend) {
+    return int(smallBackend > 0) - int(smallBackend < 0);
   }
-  catch (const std::runtime_error &) {
-    throw InvalidInputException(str);
+
+  return backend.sign();
+}
+
+size_t Integer::hash() const {
+  if (isSmallBackend) {
+    return std::hash<int64_t>{}(smallBackend);
+  }
+
+  size_t res = std::hash<int>{}(backend.sign());
+
+  for (size_t i = 0; i < backend.backend().size(); i++) {
+    res ^= std::hash<limb_type>{}(backend.backend().limbs()[i]) + 0x9e3779b97f4a7c15ULL + (res << 6) + (res >> 2);
   }
+
+  return res;
 }
 
-Integer::Integer(int64_t val) : backend(val) {
+size_t Integer::bitLength() const {
+  if (isSmallBackend) {
+    // Negate in unsigned arithmetic, so that int64_t minimum does not overflow
+    auto absVal = uint64_t(smallBackend);
+    absVal = smallBackend < 0 ? ~absVal + 1 : absVal;
+
+    size_t res = 0;
+
+    for (; absVal != 0; absVal >>= 1) {
+      res++;
+    }
+
+    return res;
+  }
+
+  return msb(abs(backend)) + 1;
 }
 
-std::string Integer::toString() const {
-  return backend.str();
+bool Integer::bit(size_t index) const {
+  if (isSmallBackend) {
+    auto absVal = uint64_t(smallBackend);
+    absVal = smallBackend < 0 ? ~absVal + 1 : absVal;
+    return index < std::numeric_limits<uint64_t>::digits && ((absVal >> index) & 1) != 0;
+  }
+
+  return bit_test(backend, unsigned(index));
 }
 
-int Integer::sign() const {
-  return backend.sign();
+cpp_int Integer::getBackend() const {
+  if (isSmallBackend) {
+    return smallBackend;
+  }
+
+  return backend;
 }
 
-const boost::multiprecision::cpp_int &Integer::getBackend() const {
+const cpp_int &Integer::getBackend(cpp_int &smallBuffer) const {
+  if (isSmallBackend) {
+    smallBuffer = smallBackend;
+    return smallBuffer;
+  }
+
   return backend;
 }
 
+std::optional<Integer> Integer::tryParse(std::string_view str) {
+  bool isNegative = !str.empty() && str.front() == '-';
+
+  if (isNegative) {
+    str.remove_prefix(1);
+  }
+
+  if (str.empty() || !std::all_of(str.begin(), str.end(), [](char ch) { return ch >= '0' && ch <= '9'; })) {
+    return {};
+  }
+
+  // Remove leading zeros, so that the backend does not treat the number as octal
+  str.remove_prefix(std::min(str.find_first_not_of('0'), str.size() - 1));
+
+  if (str.size() <= size_t(std::numeric_limits<int64_t>::digits10)) {
+    int64_t val = 0;
+    std::from_chars(str.data(), str.data() + str.size(), val);
+    return Integer(isNegative ? -val : val);
+  }
+
+  cpp_int backend = backendFromString(str);
+
+  if (isNegative) {
+    backend = -backend;
+  }
+
+  return Integer(std::move(backend));
+}
+
 bool Integer::equals(const Integer &rhs) const {
+  if (isSmallBackend || rhs.isSmallBackend) {
+    return isSmallBackend && rhs.isSmallBackend && smallBackend == rhs.smallBackend;
+  }
+
   return backend == rhs.backend;
 }
 
 bool Integer::less(const Integer &rhs) const {
+  if (isSmallBackend && rhs.isSmallBackend) {
+    return smallBackend < rhs.smallBackend;
+  }
+
+  if (isSmallBackend) {
+    return rhs.backend.sign() > 0;
+  }
+
+  if (rhs.isSmallBackend) {
+    return backend.sign() < 0;
+  }
+
   return backend < rhs.backend;
 }
 
 bool Integer::more(const Integer &rhs) const {
-  return backend > rhs.backend;
+  return rhs.less(*this);
 }
 
 Integer &Integer::add(const Integer &rhs) {
-  backend += rhs.backend;
+  if (int64_t res = 0; isSmallBackend && rhs.isSmallBackend && !addOverflow(smallBackend, rhs.smallBackend, res)) {
+    smallBackend = res;
+    return *this;
+  }
+
+  toBigBackend();
+
+  if (rhs.isSmallBackend) {
+    backend += rhs.smallBackend;
+  }
+  else {
+    backend += rhs.backend;
+  }
+
+  normalize();
   return *this;
 }
 
 Integer &Integer::substract(const Integer &rhs) {
-  backend -= rhs.backend;
+  if (int64_t res = 0; isSmallBackend && rhs.isSmallBackend && !subOverflow(smallBackend, rhs.smallBackend, res)) {
+    smallBackend = res;
+    return *this;
+  }
+
+  toBigBackend();
+
+  if (rhs.isSmallBackend) {
+    backend -= rhs.smallBackend;
+  }
+  else {
+    backend -= rhs.backend;
+  }
+
+  normalize();
   return *this;
 }
 
 Integer &Integer::multiply(const Integer &rhs) {
-  backend *= rhs.backend;
+  if (int64_t res = 0; isSmallBackend && rhs.isSmallBackend && !mulOverflow(smallBackend, rhs.smallBackend, res)) {
+    smallBackend = res;
+    return *this;
+  }
+
+  toBigBackend();
+
+  if (rhs.isSmallBackend) {
+    backend *= rhs.smallBackend;
+  }
+  else {
+    multiplyBackend(backend, rhs.backend);
+  }
+
+  normalize();
   return *this;
 }
 
@@ -99,7 +286,23 @@ Integer &Integer::divide(const Integer &rhs) {
     throw UndefinedBinaryOperatorException("/", toString(), rhs.toString());
   }
 
-  backend /= rhs.backend;
+  if (isSmallBackend && rhs.isSmallBackend &&
+      (smallBackend != std::numeric_limits<int64_t>::min() || rhs.smallBackend != -1)) {
+
+    smallBackend /= rhs.smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
+
+  if (rhs.isSmallBackend) {
+    backend /= rhs.smallBackend;
+  }
+  else {
+    divideBackend(backend, rhs.backend);
+  }
+
+  normalize();
   return *this;
 }
 
@@ -108,63 +311,152 @@ Integer &Integer::mod(const Integer &rhs) {
     throw UndefinedBinaryOperatorException("mod", toString(), rhs.toString());
   }
 
-  backend %= rhs.backend;
+  if (isSmallBackend && rhs.isSmallBackend) {
+    smallBackend = rhs.smallBackend != -1 ? smallBackend % rhs.smallBackend : 0;
+    return *this;
+  }
+
+  toBigBackend();
+
+  if (rhs.isSmallBackend) {
+    backend %= rhs.smallBackend;
+  }
+  else {
+    modBackend(backend, rhs.backend);
+  }
+
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitAnd(const Integer &rhs) {
-  backend &= rhs.backend;
+  if (isSmallBackend && rhs.isSmallBackend && smallBackend >= 0 && rhs.smallBackend >= 0) {
+    smallBackend &= rhs.smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
+  cpp_int rhsBuffer;
+  backend &= rhs.getBackend(rhsBuffer);
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitOr(const Integer &rhs) {
-  backend |= rhs.backend;
+  if (isSmallBackend && rhs.isSmallBackend && smallBackend >= 0 && rhs.smallBackend >= 0) {
+    smallBackend |= rhs.smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
+  cpp_int rhsBuffer;
+  backend |= rhs.getBackend(rhsBuffer);
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitXor(const Integer &rhs) {
-  backend ^= rhs.backend;
+  if (isSmallBackend && rhs.isSmallBackend && smallBackend >= 0 && rhs.smallBackend >= 0) {
+    smallBackend ^= rhs.smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
+  cpp_int rhsBuffer;
+  backend ^= rhs.getBackend(rhsBuffer);
+  normalize();
   return *this;
 }
 
 Integer &Integer::bitLeftShift(const Integer &rhs) {
   try {
-    backend <<= int64_t(rhs.backend);
+    toBigBackend();
+    backend <<= int64_t(rhs);
+    normalize();
     return *this;
   }
   catch (...) {
+    normalize();
     throw UndefinedBinaryOperatorException("<<", toString(), rhs.toString());
   }
 }
 
 Integer &Integer::bitRightShift(const Integer &rhs) {
   try {
-    backend >>= int64_t(rhs.backend);
+    toBigBackend();
+    backend >>= int64_t(rhs);
+    normalize();
     return *this;
   }
   catch (...) {
+    normalize();
     throw UndefinedBinaryOperatorException(">>", toString(), rhs.toString());
   }
 }
 
 Integer &Integer::bitNot() {
+  if (isSmallBackend) {
+    smallBackend = ~smallBackend;
+    return *this;
+  }
+
   backend = ~backend;
+  normalize();
   return *this;
 }
 
 Integer &Integer::negate() {
+  if (isSmallBackend && smallBackend != std::numeric_limits<int64_t>::min()) {
+    smallBackend = -smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
   backend = -backend;
+  normalize();
   return *this;
 }
 
 Integer &Integer::increase() {
+  if (isSmallBackend && smallBackend != std::numeric_limits<int64_t>::max()) {
+    ++smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
   ++backend;
+  normalize();
   return *this;
 }
 
 Integer &Integer::decrease() {
+  if (isSmallBackend && smallBackend != std::numeric_limits<int64_t>::min()) {
+    --smallBackend;
+    return *this;
+  }
+
+  toBigBackend();
   --backend;
+  normalize();
   return *this;
 }
 
-} // namespace fintamath
+void Integer::toBigBackend() {
+  if (isSmallBackend) {
+    backend = smallBackend;
+    isSmallBackend = false;
+  }
+}
+
+void Integer::normalize() {
+  if (!isSmallBackend &&
+      backend >= std::numeric_limits<int64_t>::min() &&
+      backend <= std::numeric_limits<int64_t>::max()) {
+
+    smallBackend = backend.convert_to<int64_t>();
+    backend = 0;
+    isSmallBackend = true;
+  }
+}
+
+}
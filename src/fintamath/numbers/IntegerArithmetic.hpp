@@ -0,0 +1,28 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+#include <boost/multiprecision/cpp_int.hpp>
+
+namespace fintamath {
+
+// Boost multiplies with schoolbook and Karatsuba algorithms and divides with schoolbook algorithm,
+// so huge operands are multiplied with number theoretic transform and divided with Newton's method instead.
+// Operands below the size thresholds are left to boost.
+
+void multiplyBackend(boost::multiprecision::cpp_int &lhs, const boost::multiprecision::cpp_int &rhs);
+
+void divideBackend(boost::multiprecision::cpp_int &lhs, const boost::multiprecision::cpp_int &rhs);
+
+void modBackend(boost::multiprecision::cpp_int &lhs, const boost::multiprecision::cpp_int &rhs);
+
+// Boost converts to and from decimal strings in quadratic time, so long numbers are split in halves
+// by cached powers of 10 instead, which makes the conversion as fast as the multiplication and the division.
+
+std::string backendToString(const boost::multiprecision::cpp_int &rhs);
+
+// str must consist of decimal digits only
+boost::multiprecision::cpp_int backendFromString(std::string_view str);
+
+}
@@ -1,5 +1,11 @@
 #include "fintamath/numbers/IntegerFunctions.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <utility>
+
 #include "fintamath/exceptions/UndefinedException.hpp"
 
 using namespace boost::multiprecision;
@@ -11,11 +17,15 @@ Integer abs(const Integer &rhs) {
 }
 
 Integer gcd(const Integer &lhs, const Integer &rhs) {
-  return {gcd(lhs.getBackend(), rhs.getBackend())};
+  cpp_int lhsBuffer;
+  cpp_int rhsBuffer;
+  return {gcd(lhs.getBackend(lhsBuffer), rhs.getBackend(rhsBuffer))};
 }
 
 Integer lcm(const Integer &lhs, const Integer &rhs) {
-  return {lcm(lhs.getBackend(), rhs.getBackend())};
+  cpp_int lhsBuffer;
+  cpp_int rhsBuffer;
+  return {lcm(lhs.getBackend(lhsBuffer), rhs.getBackend(rhsBuffer))};
 }
 
 Integer sqrt(const Integer &rhs) {
@@ -24,10 +34,11 @@ Integer sqrt(const Integer &rhs) {
 }
 
 Integer sqrt(const Integer &rhs, Integer &remainder) {
+  cpp_int rhsBuffer;
   cpp_int remainderBackend;
 
   try {
-    Integer res(sqrt(rhs.getBackend(), remainderBackend));
+    Integer res(sqrt(rhs.getBackend(rhsBuffer), remainderBackend));
     remainder = Integer(std::move(remainderBackend));
     return res;
   }
@@ -36,19 +47,178 @@ Integer sqrt(const Integer &rhs, Integer &remainder) {
   }
 }
 
-// Use binary splitting.
+namespace {
+
+// Uses only the leading bits, so that values of any size fit in a double
+double log2Estimate(const Integer &rhs) {
+  constexpr size_t doubleDigits = std::numeric_limits<double>::digits;
+
+  size_t shift = rhs.bitLength() > doubleDigits ? rhs.bitLength() - doubleDigits : 0;
+  cpp_int rhsBuffer;
+  cpp_int leadingBits = rhs.getBackend(rhsBuffer) >> shift;
+
+  return std::log2(leadingBits.convert_to<double>()) + double(shift);
+}
+
+}
+
+// Estimate the result from bit lengths, the estimate is off by at most one,
+// so it is corrected with the power that has to be computed anyway.
+Integer log(const Integer &lhs, const Integer &rhs, Integer &remainder) {
+  if (lhs < 2 || rhs < 1) {
+    throw UndefinedFunctionException("log", {lhs.toString(), rhs.toString()});
+  }
+
+  Integer res(int64_t(std::floor(log2Estimate(rhs) / log2Estimate(lhs))));
+  Integer resPow = pow(lhs, res);
+
+  while (resPow > rhs) {
+    res -= 1;
+    resPow /= lhs;
+  }
+
+  for (Integer nextPow = resPow * lhs; nextPow <= rhs; nextPow = resPow * lhs) {
+    res += 1;
+    resPow = std::move(nextPow);
+  }
+
+  remainder = rhs - resPow;
+  return res;
+}
+
+namespace {
+
+// 20! is the largest factorial fitting in int64_t
+constexpr size_t smallFactorialsCount = 21;
+
+constexpr std::array<int64_t, smallFactorialsCount> smallFactorials = [] {
+  std::array<int64_t, smallFactorialsCount> res{};
+  res[0] = 1;
+
+  for (size_t i = 1; i < smallFactorialsCount; i++) {
+    res[i] = res[i - 1] * int64_t(i);
+  }
+
+  return res;
+}();
+
+// Use sieve of Eratosthenes.
+// https://en.wikipedia.org/wiki/Sieve_of_Eratosthenes.
+std::vector<int64_t> primesUpTo(int64_t limit) {
+  std::vector<int64_t> primes;
+  std::vector<bool> isComposite(size_t(std::max(limit, int64_t(0))) + 1);
+
+  for (int64_t i = 2; i <= limit; i++) {
+    if (isComposite[size_t(i)]) {
+      continue;
+    }
+
+    primes.emplace_back(i);
+
+    for (int64_t j = i * i; j <= limit; j += i) {
+      isComposite[size_t(j)] = true;
+    }
+  }
+
+  return primes;
+}
+
+// Use binary splitting, so that the multiplied values have close sizes.
 // http://numbers.computation.free.fr/Constants/Algorithms/splitting.html.
-Integer factorialRec(const Integer &left, const Integer &right) {
-  if (left == right) {
-    return left;
+Integer productRec(const std::vector<Integer> &factors, size_t begin, size_t end) {
+  if (begin == end) {
+    return 1;
   }
 
-  if (right - left == 1) {
-    return left * right;
+  if (end - begin == 1) {
+    return factors[begin];
   }
 
-  Integer mid((left + right) / 2);
-  return factorialRec(left, mid) * factorialRec(mid + 1, right);
+  size_t mid = begin + (end - begin) / 2;
+  return productRec(factors, begin, mid) * productRec(factors, mid, end);
+}
+
+// Product of count terms last, last - step, last - 2 step and so on, split the same way
+Integer rangeProductRec(const Integer &last, int64_t count, int64_t step) {
+  if (count == 1) {
+    return last;
+  }
+
+  if (count == 2) {
+    return last * (last - step);
+  }
+
+  int64_t leftCount = count / 2;
+  return rangeProductRec(last, leftCount, step) * rangeProductRec(last - leftCount * step, count - leftCount, step);
+}
+
+// Use prime swing, the swing n! / ((n / 2)!)^2 contains every prime p <= n
+// to the power of the number of odd values among n / p, n / p^2 and so on.
+// http://www.luschny.de/math/factorial/SwingIntro.pdf.
+Integer primeSwing(int64_t rhs, const std::vector<int64_t> &primes) {
+  std::vector<Integer> primePowers;
+
+  for (int64_t prime : primes) {
+    if (prime > rhs) {
+      break;
+    }
+
+    // The power never exceeds rhs
+    int64_t primePower = 1;
+
+    for (int64_t quotient = rhs / prime; quotient > 0; quotient /= prime) {
+      if (quotient % 2 == 1) {
+        primePower *= prime;
+      }
+    }
+
+    if (primePower != 1) {
+      primePowers.emplace_back(primePower);
+    }
+  }
+
+  return productRec(primePowers, 0, primePowers.size());
+}
+
+Integer primeSwingFactorial(int64_t rhs, const std::vector<int64_t> &primes) {
+  if (rhs < int64_t(smallFactorialsCount)) {
+    return smallFactorials[size_t(rhs)];
+  }
+
+  Integer halfFactorial = primeSwingFactorial(rhs / 2, primes);
+  return halfFactorial * halfFactorial * primeSwing(rhs, primes);
+}
+
+// Use Legendre's formula for the exponents of primes in factorials, so that numerator! is never computed.
+// https://en.wikipedia.org/wiki/Legendre%27s_formula.
+Integer factorialsQuotient(int64_t numerator, const std::vector<int64_t> &denominators) {
+  const auto factorialPrimeExponent = [](int64_t rhs, int64_t prime) {
+    int64_t exponent = 0;
+
+    for (int64_t quotient = rhs / prime; quotient > 0; quotient /= prime) {
+      exponent += quotient;
+    }
+
+    return exponent;
+  };
+
+  std::vector<Integer> primePowers;
+
+  for (int64_t prime : primesUpTo(numerator)) {
+    int64_t exponent = factorialPrimeExponent(numerator, prime);
+
+    for (int64_t denominator : denominators) {
+      exponent -= factorialPrimeExponent(denominator, prime);
+    }
+
+    if (exponent != 0) {
+      primePowers.emplace_back(pow(Integer(prime), exponent));
+    }
+  }
+
+  return productRec(primePowers, 0, primePowers.size());
+}
+
 }
 
 Integer factorial(const Integer &rhs) {
@@ -56,11 +226,12 @@ Integer factorial(const Integer &rhs) {
     throw UndefinedUnaryOperatorException("!", rhs.toString(), UndefinedUnaryOperatorException::Type::Postfix);
   }
 
-  if (rhs < 2) {
-    return 1;
+  if (rhs < int64_t(smallFactorialsCount)) {
+    return smallFactorials[size_t(rhs)];
   }
 
-  return factorialRec(2, rhs);
+  const auto rhsValue = int64_t(rhs);
+  return primeSwingFactorial(rhsValue, primesUpTo(rhsValue));
 }
 
 Integer factorial(const Integer &rhs, size_t order) {
@@ -75,12 +246,411 @@ Integer factorial(const Integer &rhs, size_t order) {
     return factorial(rhs);
   }
 
+  if (rhs == 0) {
+    return 1;
+  }
+
   // Use generalized factorial formula.
   // https://en.wikipedia.org/wiki/Double_factorial.
 
-  Integer res = 1;
-  for (Integer i = rhs; i > 0; i -= int64_t(order)) {
-    res *= i;
+  const auto orderValue = int64_t(order);
+
+  // Every term is divisible by the order, so rhs!(order) = order^(rhs / order) (rhs / order)!
+  if (rhs % orderValue == 0) {
+    Integer quotient = rhs / orderValue;
+    return pow(Integer(orderValue), quotient) * factorial(quotient);
+  }
+
+  return rangeProductRec(rhs, int64_t((rhs + orderValue - 1) / orderValue), orderValue);
+}
+
+namespace {
+
+constexpr int64_t smallPrimesLimit = 1 << 16;
+
+const std::vector<int64_t> &getSmallPrimes() {
+  static const std::vector<int64_t> smallPrimes = primesUpTo(smallPrimesLimit);
+  return smallPrimes;
+}
+
+Integer powMod(const Integer &lhs, const Integer &rhs, const Integer &mod) {
+  cpp_int lhsBuffer;
+  cpp_int rhsBuffer;
+  cpp_int modBuffer;
+  return {powm(lhs.getBackend(lhsBuffer), rhs.getBackend(rhsBuffer), mod.getBackend(modBuffer))};
+}
+
+const std::array<Integer, 13> &getMillerRabinBases() {
+  static const std::array<Integer, 13> bases = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41};
+  return bases;
+}
+
+// Numbers below the bound are proven prime by Miller-Rabin test with all the bases above
+const Integer &getMillerRabinBound() {
+  static const Integer bound("3317044064679887385961981");
+  return bound;
+}
+
+// Use Miller-Rabin test.
+// https://en.wikipedia.org/wiki/Miller%E2%80%93Rabin_primality_test.
+bool millerRabinTest(const Integer &rhs, const Integer &base) {
+  Integer rhsPrev = rhs - 1;
+  Integer odd = rhsPrev;
+  size_t twoPower = 0;
+
+  while (!odd.bit(0)) {
+    odd >>= 1;
+    twoPower++;
+  }
+
+  Integer val = powMod(base, odd, rhs);
+
+  if (val == 1 || val == rhsPrev) {
+    return true;
+  }
+
+  for (size_t i = 1; i < twoPower && val != rhsPrev; i++) {
+    val = val * val % rhs;
+  }
+
+  return val == rhsPrev;
+}
+
+// rhs must be odd and positive
+int jacobiSymbol(Integer lhs, Integer rhs) {
+  lhs %= rhs;
+
+  if (lhs < 0) {
+    lhs += rhs;
+  }
+
+  int res = 1;
+
+  while (lhs != 0) {
+    while (!lhs.bit(0)) {
+      lhs >>= 1;
+
+      if (Integer rhsMod8 = rhs % 8; rhsMod8 == 3 || rhsMod8 == 5) {
+        res = -res;
+      }
+    }
+
+    std::swap(lhs, rhs);
+
+    if (lhs % 4 == 3 && rhs % 4 == 3) {
+      res = -res;
+    }
+
+    lhs %= rhs;
+  }
+
+  return rhs == 1 ? res : 0;
+}
+
+// Use strong Lucas probable prime test with Selfridge's parameters P = 1, Q = (1 - D) / 4, rhs must be odd.
+// https://en.wikipedia.org/wiki/Lucas_pseudoprime#Strong_Lucas_pseudoprimes.
+bool strongLucasTest(const Integer &rhs) {
+  // No suitable D exists for squares
+  if (Integer rhsSqrt = sqrt(rhs); rhsSqrt * rhsSqrt == rhs) {
+    return false;
+  }
+
+  Integer discriminant = 5;
+
+  for (int symbol = jacobiSymbol(discriminant, rhs); symbol != -1; symbol = jacobiSymbol(discriminant, rhs)) {
+    if (symbol == 0 && abs(discriminant) != rhs) {
+      return false;
+    }
+
+    discriminant = discriminant > 0 ? -(discriminant + 2) : -(discriminant - 2);
+  }
+
+  const Integer q = (1 - discriminant) / 4;
+
+  auto reduce = [&rhs](Integer val) {
+    val %= rhs;
+    return val < 0 ? val + rhs : val;
+  };
+
+  auto halve = [&rhs](Integer val) {
+    return (val.bit(0) ? val + rhs : val) >> 1;
+  };
+
+  Integer odd = rhs + 1;
+  size_t twoPower = 0;
+
+  while (!odd.bit(0)) {
+    odd >>= 1;
+    twoPower++;
+  }
+
+  // U_k, V_k and Q^k for k equal to the leading bits of odd, each step doubles k and adds the next bit
+  Integer u = 1;
+  Integer v = 1;
+  Integer qPower = reduce(q);
+
+  for (size_t i = odd.bitLength() - 1; i-- > 0;) {
+    u = reduce(u * v);
+    v = reduce(v * v - 2 * qPower);
+    qPower = reduce(qPower * qPower);
+
+    if (odd.bit(i)) {
+      Integer nextU = halve(reduce(u + v));
+      v = halve(reduce(discriminant * u + v));
+      u = std::move(nextU);
+      qPower = reduce(qPower * q);
+    }
+  }
+
+  if (u == 0 || v == 0) {
+    return true;
+  }
+
+  for (size_t i = 1; i < twoPower; i++) {
+    v = reduce(v * v - 2 * qPower);
+
+    if (v == 0) {
+      return true;
+    }
+
+    qPower = reduce(qPower * qPower);
+  }
+
+  return false;
+}
+
+// Use Pollard's rho algorithm with Brent's cycle detection, returns 0 if no divisor is found within the budget.
+// https://en.wikipedia.org/wiki/Pollard%27s_rho_algorithm#Variants.
+Integer pollardBrent(const Integer &rhs, size_t &iterations) {
+  constexpr size_t batchSize = 128;
+
+  for (Integer constant = 1; iterations > 0; ++constant) {
+    auto next = [&rhs, &constant](const Integer &val) {
+      return (val * val + constant) % rhs;
+    };
+
+    Integer slow;
+    Integer fast = 2;
+    Integer fastSaved;
+    Integer product = 1;
+    Integer divisor = 1;
+
+    for (size_t range = 1; divisor == 1; range *= 2) {
+      slow = fast;
+
+      iterations -= std::min(iterations, range);
+
+      for (size_t i = 0; i < range; i++) {
+        fast = next(fast);
+      }
+
+      for (size_t k = 0; k < range && divisor == 1; k += batchSize) {
+        if (iterations == 0) {
+          return 0;
+        }
+
+        fastSaved = fast;
+        size_t steps = std::min(batchSize, range - k);
+        iterations -= std::min(iterations, steps);
+
+        for (size_t i = 0; i < steps; i++) {
+          fast = next(fast);
+          product = product * abs(slow - fast) % rhs;
+        }
+
+        divisor = gcd(product, rhs);
+      }
+    }
+
+    if (divisor == rhs) {
+      do {
+        fastSaved = next(fastSaved);
+        divisor = gcd(abs(slow - fastSaved), rhs);
+      } while (divisor == 1);
+    }
+
+    if (divisor != rhs) {
+      return divisor;
+    }
+  }
+
+  return 0;
+}
+
+// Word operations of a modular multiplication, schoolbook multiplication and division are quadratic.
+// The constant accounts for the per-call overhead, which dominates for one-word numbers
+size_t multiplyWork(const Integer &rhs) {
+  constexpr size_t callWork = 63;
+
+  size_t words = rhs.bitLength() / std::numeric_limits<uint64_t>::digits + 1;
+  return words * words + callWork;
+}
+
+// Every test base costs a modular power, the Lucas test costs about as much as three bases
+size_t primeTestWork(const Integer &rhs) {
+  size_t basesCount = rhs < getMillerRabinBound() ? getMillerRabinBases().size() : 4;
+  auto res = double(basesCount) * double(rhs.bitLength()) * double(multiplyWork(rhs));
+  return res < double(std::numeric_limits<size_t>::max()) ? size_t(res) : std::numeric_limits<size_t>::max();
+}
+
+// Every Pollard-Brent step and primality test is paid from work, cofactors that cannot be afforded are left unsplit.
+// A cofactor too big to test for primality is still searched for small factors with the remaining steps
+void factorsRec(const Integer &rhs, std::map<Integer, Integer> &factorRates, size_t &work) {
+  if (size_t testWork = primeTestWork(rhs); testWork <= work) {
+    work -= testWork;
+
+    if (isPrime(rhs)) {
+      factorRates[rhs]++;
+      return;
+    }
+  }
+
+  const size_t stepWork = multiplyWork(rhs);
+  size_t iterations = work / stepWork;
+  Integer divisor = pollardBrent(rhs, iterations);
+  work = iterations * stepWork;
+
+  if (divisor == 0) {
+    factorRates[rhs]++;
+    return;
+  }
+
+  factorsRec(divisor, factorRates, work);
+  factorsRec(rhs / divisor, factorRates, work);
+}
+
+}
+
+bool isPrime(const Integer &rhs) {
+  if (rhs < 2) {
+    return false;
+  }
+
+  constexpr size_t trialPrimesCount = 64;
+  const std::vector<int64_t> &smallPrimes = getSmallPrimes();
+
+  for (size_t i = 0; i < trialPrimesCount; i++) {
+    int64_t prime = smallPrimes[i];
+
+    if (rhs < prime * prime) {
+      return true;
+    }
+
+    if (rhs % prime == 0) {
+      return rhs == prime;
+    }
+  }
+
+  if (rhs < getMillerRabinBound()) {
+    const auto &bases = getMillerRabinBases();
+    return std::all_of(bases.begin(), bases.end(), [&rhs](const Integer &base) { return millerRabinTest(rhs, base); });
+  }
+
+  // Use Baillie-PSW test, no composite passing it is known.
+  // https://en.wikipedia.org/wiki/Baillie%E2%80%93PSW_primality_test.
+  return millerRabinTest(rhs, 2) && strongLucasTest(rhs);
+}
+
+// Use Newton's method.
+// https://en.wikipedia.org/wiki/Nth_root#Using_Newton's_method.
+Integer root(const Integer &rhs, const Integer &degree, Integer &remainder) {
+  if (rhs < 0 || degree < 1) {
+    throw UndefinedFunctionException("root", {rhs.toString(), degree.toString()});
+  }
+
+  if (degree == 1) {
+    remainder = 0;
+    return rhs;
+  }
+
+  if (degree == 2) {
+    return sqrt(rhs, remainder);
+  }
+
+  // Roots of 1 and greater have at least one bit, so the degree can't be greater than the bit length
+  if (rhs < 2 || degree >= int64_t(rhs.bitLength())) {
+    Integer res = rhs == 0 ? 0 : 1;
+    remainder = rhs - res;
+    return res;
+  }
+
+  const Integer degreeMinusOne = degree - 1;
+
+  // One step from any positive value gives a value not less than the root, the next steps decrease to it
+  const auto newtonStep = [&rhs, &degree, &degreeMinusOne](const Integer &value) {
+    return (degreeMinusOne * value + rhs / pow(value, degreeMinusOne)) / degree;
+  };
+
+  constexpr int64_t doubleDigits = std::numeric_limits<double>::digits - 1;
+
+  double resLog2 = log2Estimate(rhs) / double(int64_t(degree));
+  int64_t shift = std::max(int64_t(resLog2) - doubleDigits, int64_t(0));
+  Integer res = newtonStep(Integer(int64_t(std::exp2(resLog2 - double(shift)))) << shift);
+
+  for (Integer nextRes = newtonStep(res); nextRes < res; nextRes = newtonStep(res)) {
+    res = std::move(nextRes);
+  }
+
+  remainder = rhs - pow(res, degree);
+  return res;
+}
+
+namespace {
+
+// A p-th power is a p-th power residue modulo every prime q = k p + 1, checking a few such q rejects most candidates
+bool isPowerResidue(const Integer &rhs, int64_t degree) {
+  constexpr size_t checksCount = 4;
+
+  size_t checks = 0;
+
+  for (int64_t mod = degree + 1; checks < checksCount; mod += degree) {
+    if (!isPrime(Integer(mod))) {
+      continue;
+    }
+
+    checks++;
+
+    Integer rhsMod = rhs % mod;
+
+    if (rhsMod != 0 && powMod(rhsMod, Integer((mod - 1) / degree), Integer(mod)) != 1) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}
+
+// Try only prime exponents, the number of trailing zeros has to be divisible by each of them.
+Integer perfectPower(const Integer &rhs, Integer &exponent) {
+  if (rhs < 2) {
+    throw UndefinedFunctionException("perfectPower", {rhs.toString()});
+  }
+
+  Integer res = rhs;
+  exponent = 1;
+
+  cpp_int rhsBuffer;
+  int64_t trailingZeros = int64_t(lsb(rhs.getBackend(rhsBuffer)));
+
+  for (int64_t prime = 2; prime < int64_t(res.bitLength()); prime = prime == 2 ? 3 : prime + 2) {
+    if ((trailingZeros != 0 && trailingZeros % prime != 0) || !isPrime(Integer(prime))) {
+      continue;
+    }
+
+    while (isPowerResidue(res, prime)) {
+      Integer remainder;
+      Integer resRoot = root(res, Integer(prime), remainder);
+
+      if (remainder != 0) {
+        break;
+      }
+
+      res = std::move(resRoot);
+      exponent *= prime;
+      trailingZeros /= prime;
+    }
   }
 
   return res;
@@ -91,25 +661,35 @@ std::map<Integer, Integer> factors(Integer rhs, Integer limit) {
     throw UndefinedFunctionException("factors", {rhs.toString()});
   }
 
-  std::map<Integer, Integer> factorRates;
-
-  while (rhs % 2 == 0) {
-    factorRates[2]++;
-    rhs /= 2;
+  if (limit < 0) {
+    return factorsWithBudget(std::move(rhs), std::numeric_limits<size_t>::max());
   }
 
+  std::map<Integer, Integer> factorRates;
+
   {
     Integer rhsSqrt = sqrt(rhs);
 
-    if (limit < 0 || limit > rhsSqrt) {
+    if (limit > rhsSqrt) {
       limit = rhsSqrt;
     }
   }
 
-  for (Integer i = 3; i <= limit; i += 2) {
+  for (int64_t prime : getSmallPrimes()) {
+    if (limit < prime) {
+      break;
+    }
+
+    while (rhs % prime == 0) {
+      factorRates[prime]++;
+      rhs /= prime;
+    }
+  }
+
+  for (Integer i = smallPrimesLimit + 1; i <= limit; i += 2) {
     while (rhs % i == 0) {
       factorRates[i]++;
-      rhs = rhs / i;
+      rhs /= i;
     }
   }
 
@@ -120,35 +700,99 @@ std::map<Integer, Integer> factors(Integer rhs, Integer limit) {
   return factorRates;
 }
 
+std::map<Integer, Integer> factorsWithBudget(Integer rhs, size_t maxWork) {
+  if (rhs < 2) {
+    throw UndefinedFunctionException("factors", {rhs.toString()});
+  }
+
+  std::map<Integer, Integer> factorRates;
+
+  for (int64_t prime : getSmallPrimes()) {
+    if (rhs < prime * prime) {
+      break;
+    }
+
+    while (rhs % prime == 0) {
+      factorRates[prime]++;
+      rhs /= prime;
+    }
+  }
+
+  if (rhs > 1) {
+    factorsRec(rhs, factorRates, maxWork);
+  }
+
+  return factorRates;
+}
+
 // Use number of combinations formula.
 // https://en.wikipedia.org/wiki/Combination#Number_of_k-combinations.
 Integer combinations(const Integer &totalNumber, const Integer &choosedNumber) {
+  if (totalNumber < 0) {
+    throw UndefinedUnaryOperatorException("!", totalNumber.toString(), UndefinedUnaryOperatorException::Type::Postfix);
+  }
+
+  if (choosedNumber < 0) {
+    throw UndefinedUnaryOperatorException("!", choosedNumber.toString(), UndefinedUnaryOperatorException::Type::Postfix);
+  }
+
   if (choosedNumber > totalNumber) {
     throw UndefinedFunctionException("combinations", {totalNumber.toString()});
   }
 
-  return factorial(totalNumber) / (factorial(choosedNumber) * factorial(totalNumber - choosedNumber));
+  const Integer minChoosedNumber = std::min(choosedNumber, totalNumber - choosedNumber);
+
+  if (minChoosedNumber == 0) {
+    return 1;
+  }
+
+  // With few terms n (n - 1) ... (n - k + 1) / k! is cheaper than sieving primes up to n
+  if (minChoosedNumber * minChoosedNumber < totalNumber) {
+    return rangeProductRec(totalNumber, int64_t(minChoosedNumber), 1) / factorial(minChoosedNumber);
+  }
+
+  return factorialsQuotient(int64_t(totalNumber), {int64_t(choosedNumber), int64_t(totalNumber - choosedNumber)});
 }
 
 // Use multinomial coefficients formula.
 // https://en.wikipedia.org/wiki/Multinomial_theorem#Multinomial_coefficients.
 Integer multinomialCoefficient(const Integer &totalNumber, const std::vector<Integer> &groupNumbers) {
   Integer checkValue;
+  Integer maxGroupNumber;
 
   for (const auto &groupNumber : groupNumbers) {
+    if (groupNumber < 0) {
+      throw UndefinedFunctionException("split", {totalNumber.toString()});
+    }
+
     checkValue += groupNumber;
+    maxGroupNumber = std::max(maxGroupNumber, groupNumber);
   }
 
   if (checkValue != totalNumber) {
     throw UndefinedFunctionException("split", {totalNumber.toString()});
   }
 
-  Integer res = factorial(totalNumber);
+  // With few elements outside the largest group, a product of binomial coefficients with few terms is cheaper
+  if (Integer restNumber = totalNumber - maxGroupNumber; restNumber * restNumber < totalNumber) {
+    Integer res = 1;
+    Integer partialNumber = 0;
+
+    for (const auto &groupNumber : groupNumbers) {
+      partialNumber += groupNumber;
+      res *= combinations(partialNumber, groupNumber);
+    }
+
+    return res;
+  }
+
+  std::vector<int64_t> groupValues;
+
   for (const auto &groupNumber : groupNumbers) {
-    res /= factorial(groupNumber);
+    groupValues.emplace_back(int64_t(groupNumber));
   }
 
-  return res;
+  return factorialsQuotient(int64_t(totalNumber), groupValues);
 }
 
 }
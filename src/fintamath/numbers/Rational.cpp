@@ -10,48 +10,13 @@
 namespace fintamath {
 
 Rational::Rational(const std::string &str) {
-  if (str.empty()) {
-    throw InvalidInputException(str);
-  }
-
-  if (str.empty() || str == ".") {
-    throw InvalidInputException(str);
-  }
-
-  int64_t firstDigitNum = 0;
-  int64_t firstDotNum = std::distance(str.begin(), std::find(str.begin(), str.end(), '.'));
-
-  bool isNegative = false;
-  if (str.front() == '-') {
-    isNegative = true;
-    firstDigitNum++;
-  }
-
-  std::string intPartStr = str.substr(size_t(firstDigitNum), size_t(firstDotNum - firstDigitNum));
-  Integer intPart;
-
-  if (!intPartStr.empty()) {
-    intPart = Integer(str.substr(size_t(firstDigitNum), size_t(firstDotNum - firstDigitNum)));
-  }
+  std::optional<Rational> res = tryParse(str);
 
-  if (firstDotNum + 1 < int64_t(str.size())) {
-    auto numeratorStr = str.substr(size_t(firstDotNum) + 1);
-    std::string denominatorStr(numeratorStr.size() + 1, '0');
-    denominatorStr.front() = '1';
-    numer = Integer(numeratorStr);
-    denom = Integer(denominatorStr);
-  }
-
-  if (intPart < 0 || numer < 0) {
+  if (!res) {
     throw InvalidInputException(str);
   }
 
-  toIrreducibleRational();
-  numer += intPart * denom;
-
-  if (isNegative) {
-    numer *= -1;
-  }
+  *this = std::move(*res);
 }
 
 Rational::Rational(Integer inNumer, Integer inDenom)
@@ -96,6 +61,57 @@ int Rational::sign() const {
   return numer.sign();
 }
 
+size_t Rational::hash() const {
+  // Rationals with denominator 1 hash as the corresponding Integer
+  if (denom == 1) {
+    return numer.hash();
+  }
+
+  size_t res = numer.hash();
+  return res ^ (denom.hash() + 0x9e3779b97f4a7c15ULL + (res << 6) + (res >> 2));
+}
+
+std::optional<Rational> Rational::tryParse(std::string_view str) {
+  bool isNegative = !str.empty() && str.front() == '-';
+
+  if (isNegative) {
+    str.remove_prefix(1);
+  }
+
+  size_t dotPos = str.find('.');
+  std::string_view intPartStr = str.substr(0, dotPos);
+  std::string_view fracPartStr = dotPos != std::string_view::npos ? str.substr(dotPos + 1) : std::string_view();
+
+  if (intPartStr.empty() && fracPartStr.empty()) {
+    return {};
+  }
+
+  std::optional<Integer> intPart = intPartStr.empty() ? Integer(0) : Integer::tryParse(intPartStr);
+  std::optional<Integer> fracPart = fracPartStr.empty() ? Integer(0) : Integer::tryParse(fracPartStr);
+
+  if (!intPart || !fracPart || (!intPartStr.empty() && intPartStr.front() == '-') ||
+      (!fracPartStr.empty() && fracPartStr.front() == '-')) {
+
+    return {};
+  }
+
+  Rational res;
+
+  if (!fracPartStr.empty()) {
+    res.numer = std::move(*fracPart);
+    res.denom = Integer(boost::multiprecision::pow(boost::multiprecision::cpp_int(10), unsigned(fracPartStr.size())));
+    res.toIrreducibleRational();
+  }
+
+  res.numer += *intPart * res.denom;
+
+  if (isNegative) {
+    res.numer = -res.numer;
+  }
+
+  return res;
+}
+
 bool Rational::equals(const Rational &rhs) const {
   return numer == rhs.numer && denom == rhs.denom;
 }
@@ -28,78 +28,66 @@ Real::Real(cpp_dec_float_100 inBackend) : backend(std::move(inBackend)) {
 }
 
 Real::Real(std::string str) : Real() {
-  if (str.empty() || str == ".") {
-    throw InvalidInputException(str);
-  }
-
-  // Validate input and remove leading zeros
-  {
-    size_t i = 0;
-    if (str.front() == '-') {
-      i++;
-    }
-
-    str.erase(i, str.find_first_not_of('0'));
-    if (str.empty()) {
-      str = "0";
-    }
+  std::optional<Real> res = tryParse(str);
 
-    size_t dotsNum = 0;
-    for (; i < str.size(); ++i) {
-      if (str[i] == '.') {
-        dotsNum++;
-      }
-      else if (str[i] < '0' || str[i] > '9') {
-        throw InvalidInputException(str);
-      }
-
-      if (dotsNum > 1) {
-        throw InvalidInputException(str);
-      }
-    }
+  if (!res) {
+    throw InvalidInputException(str);
   }
 
-  backend.assign(str);
+  *this = std::move(*res);
 }
 
 Real::Real(const Rational &val) {
   *this = Real(val.numerator()) / Real(val.denominator());
 }
 
-Real::Real(const Integer &val) : backend(val.getBackend()) {
+Real::Real(const Integer &val) {
+  cpp_int buffer;
+  backend = cpp_dec_float_100(val.getBackend(buffer));
 }
 
 Real::Real(double val) : backend(val) {
 }
 
 std::string Real::toString() const {
-  std::stringstream ss;
-  ss.precision(ouputPrecision);
-  ss << backend;
-  std::string res = ss.str();
+  std::string res;
+  appendString(res);
+  return res;
+}
 
-  size_t expPos = res.find('e');
+void Real::appendString(std::string &buffer) const {
+  // Boost keeps the digits private, so they are taken from its string and the rest is formatted in one pass
+  const std::string str = backend.str(ouputPrecision, std::ios_base::fmtflags());
 
-  if (expPos != std::string::npos) {
-    res.replace(expPos, 1, "*10^");
+  const size_t expPos = std::min(str.find('e'), str.size());
 
-    if (size_t plusPos = res.find('+'); plusPos != std::string::npos) {
-      res.replace(plusPos, 1, "");
-    }
+  buffer.append(str, 0, expPos);
 
-    if (size_t negZeroPos = res.find("-0"); negZeroPos != std::string::npos) {
-      res.replace(negZeroPos + 1, 1, "");
-    }
+  if (str.find('.') > expPos) {
+    buffer += ".0";
   }
-  else {
-    expPos = res.length();
+
+  if (expPos == str.size()) {
+    return;
   }
 
-  if (res.find('.') == std::string::npos) {
-    res.insert(expPos, ".0");
+  buffer += "*10^";
+
+  size_t expValuePos = expPos + 1;
+
+  if (str[expValuePos] == '+') {
+    expValuePos++;
   }
+  else if (str[expValuePos] == '-') {
+    buffer += '-';
+    expValuePos++;
 
-  return res;
+    if (str[expValuePos] == '0') {
+      expValuePos++;
+    }
+  }
+
+  buffer.append(str, expValuePos);
 }
 
 bool Real::isPrecise() const {
@@ -121,6 +109,49 @@ const cpp_dec_float_100 &Real::getBackend() const {
   return backend;
 }
 
+std::optional<Real> Real::tryParse(std::string_view str) {
+  bool isNegative = !str.empty() && str.front() == '-';
+
+  if (isNegative) {
+    str.remove_prefix(1);
+  }
+
+  size_t digitsNum = 0;
+  size_t dotsNum = 0;
+
+  for (char ch : str) {
+    if (ch == '.') {
+      dotsNum++;
+    }
+    else if (ch >= '0' && ch <= '9') {
+      digitsNum++;
+    }
+    else {
+      return {};
+    }
+  }
+
+  if (digitsNum == 0 || dotsNum > 1) {
+    return {};
+  }
+
+  // Remove leading zeros
+  str.remove_prefix(std::min(str.find_first_not_of('0'), str.size() - 1));
+
+  std::string backendStr;
+  backendStr.reserve(str.size() + 1);
+
+  if (isNegative) {
+    backendStr.push_back('-');
+  }
+
+  backendStr.append(str);
+
+  Real res;
+  res.backend.assign(backendStr);
+  return res;
+}
+
 bool Real::equals(const Real &rhs) const {
   return backend == rhs.backend;
 }
@@ -58,7 +58,7 @@ Real lb(const Real &rhs) {
     throw UndefinedFunctionException("lb", {rhs.toString()});
   }
 
-  return {log2(rhs.getBackend())};
+  return {log(rhs.getBackend()) / getLn2().getBackend()};
 }
 
 Real lg(const Real &rhs) {
@@ -66,7 +66,7 @@ Real lg(const Real &rhs) {
     throw UndefinedFunctionException("lg", {rhs.toString()});
   }
 
-  return {log10(rhs.getBackend())};
+  return {log(rhs.getBackend()) / getLn10().getBackend()};
 }
 
 Real sin(const Real &rhs) {
@@ -178,14 +178,37 @@ Real acoth(const Real &rhs) {
   }
 }
 
-Real getE() {
-  using boost::multiprecision::default_ops::get_constant_e;
-  return {cpp_dec_float_100(get_constant_e<cpp_dec_float_100::backend_type>())};
+// Constants are computed once on first use, function-local statics make it thread-safe
+const Real &getE() {
+  static const Real e = [] {
+    using boost::multiprecision::default_ops::get_constant_e;
+    return Real(cpp_dec_float_100(get_constant_e<cpp_dec_float_100::backend_type>()));
+  }();
+
+  return e;
+}
+
+const Real &getPi() {
+  static const Real pi = [] {
+    using boost::multiprecision::default_ops::get_constant_pi;
+    return Real(cpp_dec_float_100(get_constant_pi<cpp_dec_float_100::backend_type>()));
+  }();
+
+  return pi;
+}
+
+const Real &getLn2() {
+  static const Real ln2 = [] {
+    using boost::multiprecision::default_ops::get_constant_ln2;
+    return Real(cpp_dec_float_100(get_constant_ln2<cpp_dec_float_100::backend_type>()));
+  }();
+
+  return ln2;
 }
 
-Real getPi() {
-  using boost::multiprecision::default_ops::get_constant_pi;
-  return {cpp_dec_float_100(get_constant_pi<cpp_dec_float_100::backend_type>())};
+const Real &getLn10() {
+  static const Real ln10 = log(cpp_dec_float_100(10));
+  return ln10;
 }
 
 Real tgamma(const Real &rhs) {
@@ -1,90 +1,126 @@
 #include "fintamath/parser/Tokenizer.hpp"
 
-#include <algorithm>
-#include <regex>
+#include "fintamath/core/Registries.hpp"
 
 namespace fintamath {
 
-TokenVector Tokenizer::tokenize(std::string str) {
-  handleSpaces(str);
-
+TokenVector Tokenizer::tokenize(std::string_view str) {
   TokenVector tokens;
-  Token numberToken;
-  Token specialToken;
 
-  for (char ch : str) {
+  size_t numberTokenStart = 0;
+  size_t numberTokenLength = 0;
+  size_t specialTokenStart = 0;
+  size_t specialTokenLength = 0;
+
+  for (size_t i = 0; i < str.size(); i++) {
+    char ch = str[i];
+
     if (isDigitOrPoint(ch)) {
-      appendToken(tokens, specialToken, true);
-      numberToken.push_back(ch);
+      appendToken(tokens, str.substr(specialTokenStart, specialTokenLength), true);
+      specialTokenLength = 0;
+
+      if (numberTokenLength == 0) {
+        numberTokenStart = i;
+      }
+
+      numberTokenLength++;
     }
     else if (isSpace(ch)) {
-      appendToken(tokens, specialToken, true);
-      appendToken(tokens, numberToken, false);
+      appendToken(tokens, str.substr(specialTokenStart, specialTokenLength), true);
+      specialTokenLength = 0;
+
+      appendToken(tokens, str.substr(numberTokenStart, numberTokenLength), false);
+      numberTokenLength = 0;
     }
     else {
-      appendToken(tokens, numberToken, false);
-      specialToken.push_back(ch);
+      appendToken(tokens, str.substr(numberTokenStart, numberTokenLength), false);
+      numberTokenLength = 0;
+
+      if (specialTokenLength == 0) {
+        specialTokenStart = i;
+      }
+
+      specialTokenLength++;
     }
   }
 
-  appendToken(tokens, numberToken, false);
-  appendToken(tokens, specialToken, true);
+  appendToken(tokens, str.substr(numberTokenStart, numberTokenLength), false);
+  appendToken(tokens, str.substr(specialTokenStart, specialTokenLength), true);
 
   return tokens;
 }
 
 void Tokenizer::registerToken(const Token &token) {
-  // TODO: use more efficient algorithm to emplace
-  getRegisteredTokens().emplace_back(token);
-  std::sort(getRegisteredTokens().begin(), getRegisteredTokens().end(), [](const Token &a, const Token &b) {
-    return a.length() > b.length();
-  });
+  Registries::checkNotFrozen();
+
+  Trie &trie = getRegisteredTokens();
+  size_t nodeIndex = 0;
+
+  for (char ch : token) {
+    size_t childIndex = findChild(trie[nodeIndex], ch);
+
+    if (childIndex == 0) {
+      childIndex = trie.size();
+      trie[nodeIndex].children.emplace_back(ch, childIndex);
+      trie.emplace_back();
+    }
+
+    nodeIndex = childIndex;
+  }
+
+  trie[nodeIndex].isTokenEnd = true;
 }
 
-bool Tokenizer::appendToken(TokenVector &tokens, Token &token, bool shouldSplit) {
+void Tokenizer::appendToken(TokenVector &tokens, std::string_view token, bool shouldSplit) {
   if (token.empty()) {
-    return false;
+    return;
   }
 
   if (!shouldSplit) {
     tokens.emplace_back(token);
-    token.clear();
-    return true;
+    return;
   }
 
   while (!token.empty()) {
-    std::string nestedToken = token.substr(0, getRegisteredTokens().front().length());
-    bool isNestedTokenFind = false;
+    size_t tokenLength = findLongestTokenLength(token);
 
-    for (const auto &registeredToken : getRegisteredTokens()) {
-      if (nestedToken.length() < registeredToken.length()) {
-        continue;
-      }
+    if (tokenLength == 0) {
+      tokenLength = 1;
+    }
 
-      if (nestedToken.length() > registeredToken.length()) {
-        nestedToken = token.substr(0, registeredToken.length());
-      }
+    tokens.emplace_back(token.substr(0, tokenLength));
+    token.remove_prefix(tokenLength);
+  }
+}
 
-      if (nestedToken == registeredToken) {
-        isNestedTokenFind = true;
-        break;
-      }
-    }
+size_t Tokenizer::findLongestTokenLength(std::string_view str) {
+  const Trie &trie = getRegisteredTokens();
+  size_t longestTokenLength = 0;
+  size_t nodeIndex = 0;
 
-    if (!isNestedTokenFind) {
-      nestedToken = token.substr(0, 1);
+  for (size_t i = 0; i < str.size(); i++) {
+    nodeIndex = findChild(trie[nodeIndex], str[i]);
+
+    if (nodeIndex == 0) {
+      break;
     }
 
-    tokens.emplace_back(nestedToken);
-    token = token.substr(nestedToken.size());
+    if (trie[nodeIndex].isTokenEnd) {
+      longestTokenLength = i + 1;
+    }
   }
 
-  token.clear();
-  return true;
+  return longestTokenLength;
 }
 
-void Tokenizer::handleSpaces(std::string &str) {
-  str = std::regex_replace(str, std::regex(R"([\s\r\n]+)"), " ");
+size_t Tokenizer::findChild(const TrieNode &node, char ch) {
+  for (const auto &[childCh, childIndex] : node.children) {
+    if (childCh == ch) {
+      return childIndex;
+    }
+  }
+
+  return 0;
 }
 
 bool Tokenizer::isDigitOrPoint(char ch) {
@@ -92,7 +128,7 @@ bool Tokenizer::isDigitOrPoint(char ch) {
 }
 
 bool Tokenizer::isSpace(char ch) {
-  return ch == ' ';
+  return ch == ' ' || ch == '\t' || ch == '\n' || ch == '\v' || ch == '\f' || ch == '\r';
 }
 
 }
@@ -2,7 +2,11 @@
 
 #include "fintamath/core/IMathObject.hpp"
 
+#include "fintamath/functions/trigonometry/Cos.hpp"
+#include "fintamath/functions/trigonometry/Sin.hpp"
 #include "fintamath/literals/Variable.hpp"
+#include "fintamath/literals/constants/E.hpp"
+#include "fintamath/literals/constants/Pi.hpp"
 #include "fintamath/numbers/Integer.hpp"
 #include "fintamath/numbers/Rational.hpp"
 
@@ -90,6 +94,16 @@ TEST(IMathObjectTests, nequalsTest) {
   EXPECT_FALSE(m4 != m4);
 }
 
+TEST(IMathObjectTests, hashTest) {
+  EXPECT_EQ(TestMathObject().hash(), TestMathObject().hash());
+  EXPECT_EQ(cast<IMathObject>(Variable("a")).hash(), Variable("a").hash());
+  EXPECT_EQ(E().hash(), E().hash());
+  EXPECT_NE(E().hash(), Pi().hash());
+  EXPECT_EQ(Sin().hash(), Sin().hash());
+  EXPECT_NE(Sin().hash(), Cos().hash());
+  EXPECT_EQ(Rational(4, 2).hash(), Integer(2).hash());
+}
+
 TEST(IMathObjectTests, outputTest) {
   std::unique_ptr<IMathObject> m1 = std::make_unique<Integer>(123);
   std::stringstream out;
@@ -45,3 +45,29 @@ TEST(MathObjectTypesTests, isBaseOfTest) {
   EXPECT_FALSE(isBaseOf(IConstant::getTypeIdStatic(), INumber::getTypeIdStatic()));
   EXPECT_FALSE(isBaseOf(Boolean::getTypeIdStatic(), INumber::getTypeIdStatic()));
 }
+
+TEST(MathObjectTypesTests, isBaseOfBuiltinTest) {
+  const auto &boundIds = MathObjectBoundTypeIds::builtinBoundTypeIds;
+
+  for (size_t i = 0; i < boundIds.size(); i++) {
+    MathObjectTypeId typeId = i * MathObjectBoundTypeIds::interfaceTypeIdStep;
+
+    EXPECT_EQ(MathObjectBoundTypeIds::get().at(typeId), boundIds[i]);
+    EXPECT_TRUE(isBaseOf(typeId, typeId));
+    EXPECT_TRUE(isBaseOf(typeId, typeId + 1));
+    EXPECT_TRUE(isBaseOf(typeId, boundIds[i] - 1));
+    EXPECT_FALSE(isBaseOf(typeId, boundIds[i]));
+  }
+}
+
+TEST(MathObjectTypesTests, isBaseOfRegisteredTest) {
+  MathObjectBoundTypeIds::reg(100000, 100010);
+
+  EXPECT_TRUE(MathObjectBoundTypeIds::hasRegistered());
+  EXPECT_TRUE(isBaseOf(100000, 100000));
+  EXPECT_TRUE(isBaseOf(100000, 100009));
+  EXPECT_FALSE(isBaseOf(100000, 100010));
+  EXPECT_FALSE(isBaseOf(100000, 99999));
+  EXPECT_FALSE(isBaseOf(100001, 100002));
+  EXPECT_TRUE(isBaseOf(IMathObject::getTypeIdStatic(), 100000));
+}
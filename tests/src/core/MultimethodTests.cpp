@@ -2,8 +2,94 @@
 
 #include "fintamath/core/MultiMethod.hpp"
 
+#include "fintamath/literals/Boolean.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
+
 using namespace fintamath;
 
 TEST(MultimethodTests, multimethodTest) {
-  // TODO: implement
+  MultiMethod<std::unique_ptr<IMathObject>(const IMathObject &, const IMathObject &)> multi;
+
+  EXPECT_FALSE(multi(Integer(1), Integer(2)));
+
+  multi.add<Integer, Integer>([](const Integer &lhs, const Integer &rhs) {
+    return (lhs + rhs).clone();
+  });
+  multi.add<Integer, Rational>([](const Integer &lhs, const Rational &rhs) {
+    return (lhs * rhs).clone();
+  });
+  multi.add<Rational, Integer>([](const Rational &lhs, const Integer &rhs) {
+    return (lhs - rhs).clone();
+  });
+
+  EXPECT_EQ(*multi(Integer(2), Integer(3)), Integer(5));
+  EXPECT_EQ(*multi(Integer(2), Rational(1, 3)), Rational(2, 3));
+  EXPECT_EQ(*multi(Rational(1, 3), Integer(2)), Rational(-5, 3));
+  EXPECT_FALSE(multi(Rational(1, 2), Rational(1, 3)));
+  EXPECT_FALSE(multi(Integer(1), Real(2)));
+
+  auto multiCopy = multi;
+
+  multi.add<Integer, Integer>([](const Integer &lhs, const Integer &rhs) {
+    return (lhs - rhs).clone();
+  });
+
+  EXPECT_EQ(*multi(Integer(2), Integer(3)), Integer(-1));
+  EXPECT_EQ(*multiCopy(Integer(2), Integer(3)), Integer(5));
+}
+
+TEST(MultimethodTests, capturedFunctionTest) {
+  MultiMethod<std::string(const IMathObject &)> multi;
+
+  std::string prefix = "value: ";
+  multi.add<Integer>([prefix](const Integer &rhs) {
+    return prefix + rhs.toString();
+  });
+
+  EXPECT_EQ(multi(Integer(10)), "value: 10");
+  EXPECT_EQ(multi(Rational(1, 2)), "");
+}
+
+TEST(MultimethodTests, manyCallbacksTest) {
+  MultiMethod<int(const IMathObject &, const IMathObject &)> multi;
+
+  int index = 0;
+
+  auto addCallbacks = [&multi, &index](auto lhs) {
+    using Lhs = decltype(lhs);
+
+    multi.add<Lhs, Integer>([res = ++index](const Lhs &, const Integer &) { return res; });
+    multi.add<Lhs, Rational>([res = ++index](const Lhs &, const Rational &) { return res; });
+    multi.add<Lhs, Real>([res = ++index](const Lhs &, const Real &) { return res; });
+    multi.add<Lhs, Variable>([res = ++index](const Lhs &, const Variable &) { return res; });
+    multi.add<Lhs, Boolean>([res = ++index](const Lhs &, const Boolean &) { return res; });
+  };
+
+  addCallbacks(Integer());
+  addCallbacks(Rational());
+  addCallbacks(Real());
+  addCallbacks(Boolean());
+
+  EXPECT_EQ(multi(Integer(), Integer()), 1);
+  EXPECT_EQ(multi(Integer(), Boolean()), 5);
+  EXPECT_EQ(multi(Rational(), Real()), 8);
+  EXPECT_EQ(multi(Real(), Variable("x")), 14);
+  EXPECT_EQ(multi(Boolean(), Integer()), 16);
+  EXPECT_EQ(multi(Boolean(), Boolean()), 20);
+  EXPECT_EQ(multi(Variable("x"), Integer()), 0);
+}
+
+TEST(MultimethodTests, replacedFunctionTest) {
+  MultiMethod<int(const IMathObject &)> multi;
+
+  auto counter = std::make_shared<int>(1);
+  multi.add<Integer>([counter](const Integer &) { return *counter; });
+  EXPECT_EQ(counter.use_count(), 2);
+
+  multi.add<Integer>([](const Integer &) { return 2; });
+  EXPECT_EQ(counter.use_count(), 1);
+  EXPECT_EQ(multi(Integer()), 2);
 }
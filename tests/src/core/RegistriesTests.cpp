@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/core/Registries.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <thread>
+
+#include "fintamath/core/MathObjectTypes.hpp"
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/ExpressionFunctions.hpp"
+#include "fintamath/functions/IFunction.hpp"
+#include "fintamath/parser/Tokenizer.hpp"
+
+using namespace fintamath;
+
+TEST(RegistriesTests, concurrentExpressionsTest) {
+  const std::vector<std::string> inputs = {
+      "sin(x)^2 + cos(x)^2 + a b c - c b a",
+      "(x + 1)^5",
+      "ln(E^x) + lg(100) + 2!! + 10%",
+      "(a/(a+2) + 3/(a^2 - 4))^2",
+      "x^2 - 4 x + 4 = 0",
+      "~(a & b) | (c -> d) <-> e",
+      "sqrt(12 x^2) + root(27, 3) + 1.5 + 2/3",
+      "derivative(x^3, x) + tan(Pi/4) + asin(1)",
+  };
+
+  std::vector<std::string> expected;
+
+  for (const auto &input : inputs) {
+    expected.emplace_back(Expression(input).toString());
+  }
+
+  const std::string solveExpected = solve(Expression("x^2 - 5 x + 6 = 0")).toString();
+
+  std::atomic<size_t> mismatchesCount = 0;
+  std::vector<std::thread> threads;
+
+  for (size_t i = 0; i < 8; i++) {
+    threads.emplace_back([&inputs, &expected, &solveExpected, &mismatchesCount, i] {
+      for (size_t j = 0; j < 10; j++) {
+        size_t index = (i + j) % inputs.size();
+
+        if (Expression(inputs[index]).toString() != expected[index]) {
+          mismatchesCount++;
+        }
+
+        if (solve(Expression("x^2 - 5 x + 6 = 0")).toString() != solveExpected) {
+          mismatchesCount++;
+        }
+      }
+    });
+  }
+
+  for (auto &thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(mismatchesCount, 0);
+}
+
+TEST(RegistriesTests, freezeTest) {
+  // Freezing is irreversible, so it runs in a child process and does not affect other tests
+  EXPECT_EXIT(
+      {
+        const std::string expected = Expression("sin(x)^2 + cos(x)^2 + 2 x").toString();
+
+        Registries::freeze();
+
+        auto isRejected = [](const auto &registerFunc) {
+          try {
+            registerFunc();
+          }
+          catch (const InvalidInputException &) {
+            return true;
+          }
+
+          return false;
+        };
+
+        bool isFrozen = Registries::isFrozen() &&
+                        isRejected([] { Tokenizer::registerToken("frozen"); }) &&
+                        isRejected([] { MathObjectBoundTypeIds::reg(200000, 200010); }) &&
+                        Expression("sin(x)^2 + cos(x)^2 + 2 x").toString() == expected;
+
+        std::exit(isFrozen ? 0 : 1);
+      },
+      testing::ExitedWithCode(0), "");
+
+  EXPECT_FALSE(Registries::isFrozen());
+}
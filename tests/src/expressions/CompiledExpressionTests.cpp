@@ -0,0 +1,148 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/expressions/CompiledExpression.hpp"
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/numbers/RealFunctions.hpp"
+
+using namespace fintamath;
+
+using OpCode = CompiledExpression::OpCode;
+
+TEST(CompiledExpressionTests, compileTest) {
+  CompiledExpression compiled = Expression("x^2 + sin(x) y").compile({Variable("x"), Variable("y")});
+  EXPECT_EQ(compiled.getVariables(), std::vector<Variable>({Variable("x"), Variable("y")}));
+  EXPECT_EQ(compiled.getInstructions().back().code, OpCode::Add);
+
+  compiled = Expression("y + x").compile();
+  EXPECT_EQ(compiled.getVariables(), std::vector<Variable>({Variable("x"), Variable("y")}));
+
+  compiled = Expression("2").compile();
+  EXPECT_TRUE(compiled.getVariables().empty());
+  EXPECT_EQ(compiled.getInstructions().size(), 1);
+
+  EXPECT_THROW(Expression("x + y").compile({Variable("x")}), InvalidInputException);
+  EXPECT_THROW(Expression("x!").compile(), InvalidInputException);
+  EXPECT_THROW(Expression("x = 1").compile(), InvalidInputException);
+  EXPECT_THROW(Expression("x + Inf").compile(), InvalidInputException);
+}
+
+TEST(CompiledExpressionTests, commonSubexpressionsTest) {
+  CompiledExpression compiled = Expression("sin(x)^2 + sin(x) + cos(sin(x))").compile();
+
+  size_t sinCount = 0;
+  size_t loadCount = 0;
+
+  for (const auto &inst : compiled.getInstructions()) {
+    sinCount += inst.code == OpCode::Sin;
+    loadCount += inst.code == OpCode::LoadVariable;
+  }
+
+  EXPECT_EQ(sinCount, 1);
+  EXPECT_EQ(loadCount, 1);
+}
+
+TEST(CompiledExpressionTests, evaluateDoubleTest) {
+  CompiledExpression compiled = Expression("x^2 + 3 x y - y/4").compile({Variable("x"), Variable("y")});
+  EXPECT_DOUBLE_EQ(compiled.evaluate<double>({2, 4}), 27);
+  EXPECT_DOUBLE_EQ(compiled.evaluate<double>({-1.5, 0.5}), -0.125);
+
+  compiled = Expression("sqrt(x) + ln(x) + lb(x) + lg(x) + log(3, x)").compile();
+  EXPECT_NEAR(compiled.evaluate<double>({81}), 9 + std::log(81.) + std::log2(81.) + std::log10(81.) + 4, 1e-12);
+
+  compiled = Expression("sin(x) cos(x) + tan(x) - cot(x) + E^x + Pi").compile();
+  double x = 0.7;
+  EXPECT_NEAR(compiled.evaluate<double>({x}), std::sin(x) * std::cos(x) + std::tan(x) - 1 / std::tan(x) + std::exp(x) + M_PI, 1e-12);
+
+  compiled = Expression("asin(x) + acos(x) + atan(x) + acot(x) + sinh(x) + cosh(x) + tanh(x) + asinh(x)").compile();
+  x = 0.3;
+  EXPECT_NEAR(compiled.evaluate<double>({x}), std::asin(x) + std::acos(x) + std::atan(x) + std::atan(1 / x) + std::sinh(x) + std::cosh(x) + std::tanh(x) + std::asinh(x), 1e-12);
+
+  compiled = Expression("abs(x) + x^(-3) + x^(2/3)").compile();
+  EXPECT_NEAR(compiled.evaluate<double>({8}), 8 + 1. / 512 + 4, 1e-12);
+
+  compiled = Expression("x^y").compile();
+  EXPECT_DOUBLE_EQ(compiled.evaluate<double>({2, 10}), 1024);
+  EXPECT_DOUBLE_EQ(compiled.evaluate<double>({9, 0.5}), 3);
+
+  EXPECT_THROW(compiled.evaluate<double>({2}), InvalidInputException);
+}
+
+TEST(CompiledExpressionTests, evaluateRealTest) {
+  CompiledExpression compiled = Expression("x^2 + 3 x y - y/4").compile({Variable("x"), Variable("y")});
+  EXPECT_EQ(compiled.evaluate<Real>({Real(2), Real(4)}), Real(27));
+
+  compiled = Expression("sin(x) + sqrt(x)").compile();
+  EXPECT_EQ(compiled.evaluate<Real>({Real("0.5")}), sin(Real("0.5")) + sqrt(Real("0.5")));
+
+  compiled = Expression("E^x").compile();
+  EXPECT_EQ(compiled.evaluate<Real>({Real(1)}), getE());
+
+  compiled = Expression("ln(x)").compile();
+  EXPECT_THROW(compiled.evaluate<Real>({Real(-1)}), UndefinedException);
+}
+
+TEST(CompiledExpressionTests, evaluateRationalTest) {
+  CompiledExpression compiled = Expression("x^2 + 3 x y - y/4 + abs(x)").compile({Variable("x"), Variable("y")});
+  EXPECT_EQ(compiled.evaluate<Rational>({Rational(1, 2), Rational(-1, 3)}), Rational(1, 3));
+
+  compiled = Expression("x^(-2) + x^y").compile({Variable("x"), Variable("y")});
+  EXPECT_EQ(compiled.evaluate<Rational>({Rational(2, 3), Rational(3)}), Rational(275, 108));
+  EXPECT_THROW(compiled.evaluate<Rational>({Rational(2, 3), Rational(1, 2)}), UndefinedException);
+
+  compiled = Expression("sin(x)").compile();
+  EXPECT_THROW(compiled.evaluate<Rational>({Rational(1)}), UndefinedException);
+
+  compiled = Expression("x + Pi").compile();
+  EXPECT_THROW(compiled.evaluate<Rational>({Rational(1)}), UndefinedException);
+  EXPECT_NEAR(compiled.evaluate<double>({1}), 1 + M_PI, 1e-12);
+}
+
+TEST(CompiledExpressionTests, evaluateBatchTest) {
+  CompiledExpression compiled = Expression("x^2 + sin(x) y - x^(-3) + ln(y)/x + y^x + acot(x) + 2").compile({Variable("x"), Variable("y")});
+
+  // Crosses several evaluation blocks and ends with a partial one
+  size_t size = 1000;
+  std::vector<double> xs(size);
+  std::vector<double> ys(size);
+
+  for (size_t i = 0; i < size; i++) {
+    xs[i] = 0.5 + double(i) / 100;
+    ys[i] = 3 - double(i) / 1000;
+  }
+
+  std::vector<double> res = compiled.evaluateBatch({xs, ys});
+  ASSERT_EQ(res.size(), size);
+
+  for (size_t i = 0; i < size; i++) {
+    EXPECT_DOUBLE_EQ(res[i], compiled.evaluate<double>({xs[i], ys[i]}));
+  }
+
+  std::vector<double> output(3);
+  compiled.evaluateBatch({xs.data() + 10, ys.data() + 10}, output.data(), output.size());
+  EXPECT_DOUBLE_EQ(output[0], res[10]);
+  EXPECT_DOUBLE_EQ(output[2], res[12]);
+
+  EXPECT_TRUE(compiled.evaluateBatch({{}, {}}).empty());
+
+  EXPECT_THROW(compiled.evaluateBatch({xs}), InvalidInputException);
+  EXPECT_THROW(compiled.evaluateBatch({xs, {1, 2}}), InvalidInputException);
+
+  CompiledExpression copy = compiled;
+  EXPECT_EQ(copy.evaluateBatch({xs, ys}), res);
+
+  compiled = Expression("x").compile();
+  EXPECT_EQ(compiled.evaluateBatch({{1, 2, 3}}), std::vector<double>({1, 2, 3}));
+  EXPECT_EQ(copy.evaluateBatch({xs, ys}), res);
+}
+
+TEST(CompiledExpressionTests, copyTest) {
+  CompiledExpression compiled = Expression("x^3").compile();
+  EXPECT_DOUBLE_EQ(compiled.evaluate<double>({2}), 8);
+
+  CompiledExpression copy = compiled;
+  EXPECT_DOUBLE_EQ(copy.evaluate<double>({3}), 27);
+  EXPECT_DOUBLE_EQ(compiled.evaluate<double>({4}), 64);
+}
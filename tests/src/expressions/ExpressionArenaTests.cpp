@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/expressions/ExpressionArena.hpp"
+
+#include <thread>
+
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/SimplificationCache.hpp"
+#include "fintamath/numbers/Integer.hpp"
+
+using namespace fintamath;
+
+TEST(ExpressionArenaTests, allocateTest) {
+  EXPECT_EQ(ExpressionArena::getCurrent(), nullptr);
+
+  ExpressionArena arena;
+  EXPECT_EQ(ExpressionArena::getCurrent(), &arena);
+  EXPECT_EQ(arena.getAllocationsCount(), 0);
+  EXPECT_EQ(arena.getAllocatedBytes(), 0);
+
+  Expression expr("(x + 1)^3 + sin(y)/2");
+  EXPECT_EQ(expr.toString(), "x^3 + 3 x^2 + 3 x + sin(y)/2 + 1");
+  EXPECT_GT(arena.getAllocationsCount(), 0);
+  EXPECT_GT(arena.getAllocatedBytes(), arena.getAllocationsCount());
+}
+
+TEST(ExpressionArenaTests, outliveTest) {
+  std::unique_ptr<Expression> expr;
+
+  {
+    ExpressionArena arena;
+    expr = std::make_unique<Expression>("a b + a b");
+  }
+
+  EXPECT_EQ(ExpressionArena::getCurrent(), nullptr);
+  EXPECT_EQ(expr->toString(), "2 a b");
+
+  *expr += Expression("c");
+  EXPECT_EQ(expr->toString(), "2 a b + c");
+}
+
+TEST(ExpressionArenaTests, nestedTest) {
+  ExpressionArena outer;
+
+  {
+    ExpressionArena inner(false, 16);
+    EXPECT_EQ(ExpressionArena::getCurrent(), &inner);
+
+    EXPECT_EQ(Expression("a + a").toString(), "2 a");
+    EXPECT_GT(inner.getAllocationsCount(), 0);
+  }
+
+  EXPECT_EQ(ExpressionArena::getCurrent(), &outer);
+
+  size_t allocationsCount = outer.getAllocationsCount();
+  EXPECT_EQ(Expression("b b").toString(), "b^2");
+  EXPECT_GT(outer.getAllocationsCount(), allocationsCount);
+}
+
+TEST(ExpressionArenaTests, otherThreadTest) {
+  std::unique_ptr<Expression> expr;
+
+  {
+    ExpressionArena arena;
+    expr = std::make_unique<Expression>("x^2 x");
+
+    std::thread([] {
+      EXPECT_EQ(ExpressionArena::getCurrent(), nullptr);
+    }).join();
+  }
+
+  std::thread([&expr] {
+    EXPECT_EQ(expr->toString(), "x^3");
+    expr.reset();
+  }).join();
+
+  EXPECT_FALSE(expr);
+}
+
+TEST(ExpressionArenaTests, isAllocatedTest) {
+  std::unique_ptr<IMathObject> heapObj = Integer(1).clone();
+  std::unique_ptr<IMathObject> arenaObj;
+
+  {
+    ExpressionArena arena;
+    arenaObj = Integer(2).clone();
+
+    EXPECT_TRUE(ExpressionArena::isAllocated(arenaObj.get()));
+    EXPECT_FALSE(ExpressionArena::isAllocated(heapObj.get()));
+  }
+
+  EXPECT_TRUE(ExpressionArena::isAllocated(arenaObj.get()));
+  EXPECT_FALSE(ExpressionArena::isAllocated(heapObj.get()));
+  EXPECT_FALSE(ExpressionArena::isAllocated(nullptr));
+}
+
+TEST(ExpressionArenaTests, simplificationCacheTest) {
+  SimplificationCache::clear();
+
+  {
+    ExpressionArena arena;
+    EXPECT_EQ(Expression("a b + a b").toString(), "2 a b");
+    EXPECT_EQ(SimplificationCache::size(), 0);
+  }
+
+  EXPECT_EQ(Expression("a b + a b").toString(), "2 a b");
+  EXPECT_GT(SimplificationCache::size(), 0);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/expressions/ExpressionInterner.hpp"
+
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/functions/arithmetic/Add.hpp"
+#include "fintamath/functions/powers/Pow.hpp"
+#include "fintamath/functions/trigonometry/Sin.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/Integer.hpp"
+#include "fintamath/numbers/Rational.hpp"
+
+using namespace fintamath;
+
+TEST(ExpressionInternerTests, internTest) {
+  ExpressionInterner::clear();
+
+  ArgumentPtr lhs = makeExpr(Pow(), makeExpr(Sin(), Variable("x")), std::make_shared<Integer>(2));
+  ArgumentPtr rhs = makeExpr(Pow(), makeExpr(Sin(), Variable("x")), std::make_shared<Integer>(2));
+  EXPECT_NE(lhs, rhs);
+
+  ArgumentPtr internedLhs = ExpressionInterner::intern(lhs);
+  ArgumentPtr internedRhs = ExpressionInterner::intern(rhs);
+  EXPECT_EQ(internedLhs, internedRhs);
+  EXPECT_EQ(*internedLhs, *lhs);
+  EXPECT_EQ(internedLhs->toString(), "sin(x)^2");
+
+  ArgumentPtr sum = ExpressionInterner::intern(makeExpr(Add(), lhs, rhs));
+  auto sumChildren = cast<IExpression>(sum)->getChildren();
+  EXPECT_EQ(sumChildren[0], sumChildren[1]);
+  EXPECT_EQ(sumChildren[0], internedLhs);
+
+  EXPECT_NE(ExpressionInterner::intern(makeExpr(Pow(), makeExpr(Sin(), Variable("y")), std::make_shared<Integer>(2))), internedLhs);
+  EXPECT_NE(ExpressionInterner::intern(std::make_shared<Integer>(2)), ExpressionInterner::intern(std::make_shared<Rational>(2)));
+
+  EXPECT_EQ(ExpressionInterner::intern({}), nullptr);
+}
+
+TEST(ExpressionInternerTests, hashTest) {
+  ArgumentPtr lhs = makeExpr(Pow(), makeExpr(Sin(), Variable("x")), std::make_shared<Integer>(2));
+  ArgumentPtr rhs = makeExpr(Pow(), makeExpr(Sin(), Variable("x")), std::make_shared<Integer>(2));
+  EXPECT_EQ(ExpressionInterner::hash(lhs), ExpressionInterner::hash(rhs));
+  EXPECT_EQ(ExpressionInterner::hash(lhs), ExpressionInterner::hash(ExpressionInterner::intern(rhs)));
+
+  EXPECT_NE(ExpressionInterner::hash(lhs), ExpressionInterner::hash(makeExpr(Pow(), makeExpr(Sin(), Variable("x")), std::make_shared<Integer>(3))));
+  EXPECT_EQ(ExpressionInterner::hash({}), 0);
+}
+
+TEST(ExpressionInternerTests, sizeTest) {
+  ExpressionInterner::clear();
+  EXPECT_EQ(ExpressionInterner::size(), 0);
+
+  {
+    ArgumentPtr expr = ExpressionInterner::intern(makeExpr(Sin(), Variable("x")));
+    EXPECT_EQ(ExpressionInterner::size(), 2);
+  }
+
+  EXPECT_EQ(ExpressionInterner::size(), 0);
+}
+
+TEST(ExpressionInternerTests, enabledTest) {
+  EXPECT_FALSE(ExpressionInterner::isEnabled());
+
+  ExpressionInterner::setEnabled(true);
+  EXPECT_TRUE(ExpressionInterner::isEnabled());
+
+  Expression lhs("sin(x)^2 + cos(x)^2 + sin(x)^2 y");
+  Expression rhs("sin(x)^2 + cos(x)^2 + sin(x)^2 y");
+  EXPECT_EQ(lhs.getChildren().front(), rhs.getChildren().front());
+  EXPECT_EQ(lhs, rhs);
+  EXPECT_EQ(lhs.toString(), "sin(x)^2 y + sin(x)^2 + cos(x)^2");
+
+  ExpressionInterner::setEnabled(false);
+  ExpressionInterner::clear();
+  EXPECT_FALSE(ExpressionInterner::isEnabled());
+
+  Expression expr("sin(x)^2 + cos(x)^2 + sin(x)^2 y");
+  EXPECT_NE(expr.getChildren().front(), lhs.getChildren().front());
+  EXPECT_EQ(expr, lhs);
+}
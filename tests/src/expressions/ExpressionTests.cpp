@@ -1278,6 +1278,12 @@ TEST(ExpressionTests, stringConstructorLargeTest) {
                 .toString(),
             "a | b | c | d | e | f | g | h | i | j | k | l | m | n | o | p | q | r | s | t | u | v | w | x | x_1 | x_2 "
             "| (x_3 & x_4) | y | z");
+
+  std::string longSum = "a";
+  for (size_t i = 1; i < 500; i++) {
+    longSum += " + a";
+  }
+  EXPECT_EQ(Expression(longSum).toString(), "500 a");
 }
 
 TEST(ExpressionTests, stringConstructorNegativeTest) {
@@ -0,0 +1,85 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/expressions/ParallelSampler.hpp"
+
+#include "fintamath/exceptions/InvalidInputException.hpp"
+#include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/expressions/Expression.hpp"
+
+using namespace fintamath;
+
+namespace {
+
+std::vector<std::vector<double>> makeColumns(size_t size) {
+  std::vector<double> xs(size);
+  std::vector<double> ys(size);
+
+  for (size_t i = 0; i < size; i++) {
+    xs[i] = double(i % 1000) / 250 - 2;
+    ys[i] = double(i) / double(size) + 1;
+  }
+
+  return {xs, ys};
+}
+
+}
+
+TEST(ParallelSamplerTests, constructorTest) {
+  EXPECT_EQ(ParallelSampler(Expression("x").compile(), 3).getThreadsCount(), 3);
+  EXPECT_GE(ParallelSampler(Expression("x").compile()).getThreadsCount(), 1);
+}
+
+TEST(ParallelSamplerTests, evaluateTest) {
+  CompiledExpression compiled = Expression("sin(x) y^2 + ln(y) - x/y").compile({Variable("x"), Variable("y")});
+  std::vector<std::vector<double>> columns = makeColumns(20000);
+  std::vector<double> expected = compiled.evaluateBatch(columns);
+
+  for (size_t threadsCount : {1, 2, 4, 7}) {
+    EXPECT_EQ(ParallelSampler(compiled, threadsCount).evaluate(columns), expected);
+  }
+
+  EXPECT_TRUE(ParallelSampler(compiled, 4).evaluate(std::vector<std::vector<double>>{{}, {}}).empty());
+  EXPECT_THROW(ParallelSampler(compiled, 4).evaluate(std::vector<std::vector<double>>{{1}}), InvalidInputException);
+  EXPECT_THROW(ParallelSampler(compiled, 4).evaluate(std::vector<std::vector<double>>{{1}, {1, 2}}), InvalidInputException);
+}
+
+TEST(ParallelSamplerTests, evaluateRealTest) {
+  CompiledExpression compiled = Expression("x^2 + 1/x").compile();
+  std::vector<Real> xs;
+
+  for (int64_t i = 1; i <= 5000; i++) {
+    xs.emplace_back(Rational(i, 7));
+  }
+
+  std::vector<Real> res = ParallelSampler(compiled, 3).evaluate(std::vector<std::vector<Real>>{xs});
+  ASSERT_EQ(res.size(), xs.size());
+  EXPECT_EQ(res[0], compiled.evaluate<Real>({xs[0]}));
+  EXPECT_EQ(res[4999], compiled.evaluate<Real>({xs[4999]}));
+
+  xs[4321] = -1;
+  EXPECT_THROW(ParallelSampler(Expression("ln(x)").compile(), 3).evaluate(std::vector<std::vector<Real>>{xs}), UndefinedException);
+}
+
+TEST(ParallelSamplerTests, sumTest) {
+  CompiledExpression compiled = Expression("sin(x) y^2 + ln(y) - x/y").compile({Variable("x"), Variable("y")});
+  std::vector<std::vector<double>> columns = makeColumns(100000);
+
+  double expected = ParallelSampler(compiled, 1).sum(columns);
+
+  // The reduction order does not depend on the threads count, so the results are bitwise equal
+  for (size_t threadsCount : {2, 3, 8}) {
+    EXPECT_EQ(ParallelSampler(compiled, threadsCount).sum(columns), expected);
+  }
+
+  std::vector<double> values = compiled.evaluateBatch(columns);
+  double naiveSum = 0;
+
+  for (double value : values) {
+    naiveSum += value;
+  }
+
+  EXPECT_NEAR(expected, naiveSum, 1e-6 * std::abs(naiveSum));
+
+  EXPECT_EQ(ParallelSampler(Expression("x + 1").compile(), 4).sum(std::vector<std::vector<Real>>{{Real(1), Real(2), Real(3)}}), Real(9));
+  EXPECT_EQ(ParallelSampler(compiled, 4).sum(std::vector<std::vector<double>>{{}, {}}), 0);
+}
@@ -0,0 +1,132 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/expressions/SimplificationCache.hpp"
+
+#include "fintamath/expressions/Expression.hpp"
+#include "fintamath/expressions/ExpressionFunctions.hpp"
+#include "fintamath/functions/arithmetic/Add.hpp"
+#include "fintamath/functions/trigonometry/Sin.hpp"
+#include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/Integer.hpp"
+
+using namespace fintamath;
+
+TEST(SimplificationCacheTests, findTest) {
+  ArgumentPtr expr = makeExpr(Add(), Variable("x"), Variable("x"));
+  ArgumentPtr simplExpr = std::make_shared<Expression>("2x");
+
+  SimplificationCache::clear();
+  SimplificationCache::resetStatistics();
+
+  EXPECT_EQ(SimplificationCache::find(expr), nullptr);
+  EXPECT_EQ(SimplificationCache::getHits(), 0);
+  EXPECT_EQ(SimplificationCache::getMisses(), 1);
+
+  SimplificationCache::insert(expr, simplExpr);
+  EXPECT_EQ(SimplificationCache::size(), 1);
+
+  EXPECT_EQ(SimplificationCache::find(makeExpr(Add(), Variable("x"), Variable("x"))), simplExpr);
+  EXPECT_EQ(SimplificationCache::getHits(), 1);
+  EXPECT_EQ(SimplificationCache::getMisses(), 1);
+
+  EXPECT_EQ(SimplificationCache::find(makeExpr(Add(), Variable("x"), Variable("y"))), nullptr);
+  EXPECT_EQ(SimplificationCache::getHits(), 1);
+  EXPECT_EQ(SimplificationCache::getMisses(), 2);
+
+  EXPECT_EQ(SimplificationCache::find({}), nullptr);
+
+  SimplificationCache::resetStatistics();
+  EXPECT_EQ(SimplificationCache::getHits(), 0);
+  EXPECT_EQ(SimplificationCache::getMisses(), 0);
+
+  SimplificationCache::clear();
+  EXPECT_EQ(SimplificationCache::size(), 0);
+}
+
+TEST(SimplificationCacheTests, capacityTest) {
+  SimplificationCache::clear();
+
+  size_t capacity = SimplificationCache::getCapacity();
+  SimplificationCache::setCapacity(2);
+  EXPECT_EQ(SimplificationCache::getCapacity(), 2);
+
+  ArgumentPtr first = makeExpr(Sin(), Variable("a"));
+  ArgumentPtr second = makeExpr(Sin(), Variable("b"));
+  ArgumentPtr third = makeExpr(Sin(), Variable("c"));
+
+  SimplificationCache::insert(first, first);
+  SimplificationCache::insert(second, second);
+  EXPECT_EQ(SimplificationCache::find(first), first);
+
+  SimplificationCache::insert(third, third);
+  EXPECT_EQ(SimplificationCache::size(), 2);
+  EXPECT_EQ(SimplificationCache::find(first), first);
+  EXPECT_EQ(SimplificationCache::find(second), nullptr);
+  EXPECT_EQ(SimplificationCache::find(third), third);
+
+  SimplificationCache::setCapacity(0);
+  EXPECT_EQ(SimplificationCache::size(), 0);
+
+  SimplificationCache::insert(first, first);
+  EXPECT_EQ(SimplificationCache::find(first), nullptr);
+
+  SimplificationCache::setCapacity(capacity);
+}
+
+TEST(SimplificationCacheTests, stageTest) {
+  ArgumentPtr expr = makeExpr(Add(), Variable("x"), Variable("x"));
+  ArgumentPtr simplExpr = std::make_shared<Expression>("2x");
+
+  SimplificationCache::clear();
+
+  SimplificationCache::insert(expr, simplExpr, SimplificationCache::Stage::PostSimplify);
+  EXPECT_EQ(SimplificationCache::find(expr), nullptr);
+  EXPECT_EQ(SimplificationCache::find(expr, SimplificationCache::Stage::PreSimplify), nullptr);
+  EXPECT_EQ(SimplificationCache::find(expr, SimplificationCache::Stage::PostSimplify), simplExpr);
+
+  ArgumentPtr sameExpr = makeExpr(Add(), Variable("x"), Variable("x"));
+  SimplificationCache::insert(expr, expr, SimplificationCache::Stage::PreSimplify);
+  EXPECT_EQ(SimplificationCache::find(sameExpr, SimplificationCache::Stage::PreSimplify), sameExpr);
+
+  SimplificationCache::clear();
+}
+
+TEST(SimplificationCacheTests, expressionTest) {
+  SimplificationCache::clear();
+  SimplificationCache::resetStatistics();
+
+  Expression lhs("sin(x)^2 + 2 sin(x)^2 + x y + y x");
+  size_t hits = SimplificationCache::getHits();
+  size_t misses = SimplificationCache::getMisses();
+  EXPECT_GT(misses, 0);
+
+  Expression rhs("sin(x)^2 + 2 sin(x)^2 + x y + y x");
+  EXPECT_EQ(SimplificationCache::getHits(), hits + 1);
+  EXPECT_EQ(SimplificationCache::getMisses(), misses);
+  EXPECT_EQ(lhs.getChildren().front(), rhs.getChildren().front());
+  EXPECT_EQ(rhs.toString(), "3 sin(x)^2 + 2 x y");
+
+  Expression expr(rhs.getChildren().front());
+  EXPECT_EQ(SimplificationCache::getHits(), hits + 1);
+  EXPECT_EQ(SimplificationCache::getMisses(), misses);
+  EXPECT_EQ(expr.getChildren().front(), rhs.getChildren().front());
+}
+
+TEST(SimplificationCacheTests, subtreeTest) {
+  SimplificationCache::clear();
+  SimplificationCache::resetStatistics();
+
+  Expression lhs("sin(x)^2 + ln(x y + y x)");
+  size_t hits = SimplificationCache::getHits();
+
+  Expression rhs("cos(x)^2 - ln(x y + y x)");
+  EXPECT_GT(SimplificationCache::getHits(), hits);
+  EXPECT_EQ(rhs.toString(), "cos(x)^2 - ln(2 x y)");
+}
+
+TEST(SimplificationCacheTests, solutionTest) {
+  SimplificationCache::clear();
+
+  EXPECT_EQ(Expression("x = 1 | x = -1").toString(), "x - 1 = 0 | x + 1 = 0");
+  EXPECT_EQ(solve(Expression("x^2 = 1")).toString(), "x = -1 | x = 1");
+}
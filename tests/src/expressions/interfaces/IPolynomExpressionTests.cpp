@@ -2,6 +2,7 @@
 
 #include "fintamath/expressions/interfaces/IPolynomExpression.hpp"
 
+#include "fintamath/expressions/ExpressionArena.hpp"
 #include "fintamath/expressions/ExpressionUtils.hpp"
 #include "fintamath/functions/arithmetic/Add.hpp"
 #include "fintamath/functions/arithmetic/Mul.hpp"
@@ -17,6 +18,8 @@ public:
   explicit TestPolynomExpression(const ArgumentsPtrVector &children) : IPolynomExpressionCRTP(f, children) {
   }
 
+  using IPolynomExpression::simplify;
+
   static MathObjectTypeId getTypeIdStatic() {
     return MathObjectTypeId(MathObjectType::IPolynomExpression) + 999;
   }
@@ -72,6 +75,20 @@ TEST(IPolynomExpressionTests, addElement) {
   EXPECT_EQ(expr.toString(), "1 * 2 * 3 * 0");
 }
 
+TEST(IPolynomExpressionTests, simplifyTest) {
+  TestPolynomExpression expr({Integer(2).clone(), Integer(3).clone(), Variable("a").clone()});
+  ArgumentPtr simpl = expr.simplify();
+  EXPECT_EQ(simpl->toString(), "a * 6");
+
+  expr = TestPolynomExpression({Variable("b").clone(), makeExpr(Add(), Variable("c"), Variable("d")), Variable("a").clone()});
+  simpl = expr.simplify();
+  ASSERT_TRUE(simpl);
+
+  ExpressionArena arena;
+  EXPECT_FALSE(cast<TestPolynomExpression>(simpl)->simplify());
+  EXPECT_EQ(arena.getAllocationsCount(), 0);
+}
+
 TEST(IPolynomExpressionTests, toMinimalObjectTest) {
   TestPolynomExpression expr({Integer(1).clone(), Integer(2).clone(), Variable("a").clone()});
   EXPECT_EQ(expr.toMinimalObject()->toString(), "a * 2");
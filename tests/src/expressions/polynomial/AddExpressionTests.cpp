@@ -10,3 +10,19 @@ using namespace fintamath;
 TEST(AddExpressionTests, getTypeIdTest) {
   EXPECT_EQ(makeExpr(Add(), Integer(0), Integer(0))->getTypeId(), MathObjectTypeId(MathObjectType::AddExpression));
 }
+
+TEST(AddExpressionTests, manyChildrenTest) {
+  std::string str;
+  std::string reversedStr;
+
+  for (size_t i = 1; i <= 200; i++) {
+    std::string term = "x^" + std::to_string(i) + " + " + std::to_string(i);
+    str += (str.empty() ? "" : " + ") + term;
+    reversedStr = term + (reversedStr.empty() ? "" : " + ") + reversedStr;
+  }
+
+  std::string res = Expression(str).toString();
+  EXPECT_EQ(res, Expression(reversedStr).toString());
+  EXPECT_EQ(res.substr(0, 17), "x^200 + x^199 + x");
+  EXPECT_EQ(res.substr(res.size() - 15), "x^2 + x + 20100");
+}
@@ -9,3 +9,13 @@ using namespace fintamath;
 TEST(OrExpressionTests, getTypeIdTest) {
   EXPECT_EQ(makeExpr(Or(), Integer(0), Integer(0))->getTypeId(), MathObjectTypeId(MathObjectType::OrExpression));
 }
+
+TEST(OrExpressionTests, manyChildrenTest) {
+  std::string str = "a";
+
+  for (char var = 'b'; var <= 'z'; var++) {
+    str += " | a & " + std::string(1, var) + " | b & " + std::string(1, var);
+  }
+
+  EXPECT_EQ(Expression(str).toString(), "a | b");
+}
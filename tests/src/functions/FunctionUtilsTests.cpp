@@ -90,6 +90,21 @@ TEST(FunctionUtilsTests, makeExpressionRefsTest) {
   EXPECT_THROW(makeExpr(Pow(), ArgumentsRefVector{})->toString(), InvalidInputException);
 }
 
+TEST(FunctionUtilsTests, makeExpressionSameNameTest) {
+  auto var = std::make_shared<Variable>("a");
+
+  auto expr1 = makeExpr(Neg(), var);
+  EXPECT_EQ(expr1->toString(), "-a");
+  EXPECT_EQ(*cast<IExpression>(*expr1).getFunction(), Mul());
+
+  auto expr2 = makeExpr(Sub(), var, var);
+  EXPECT_EQ(expr2->toString(), "a - a");
+  EXPECT_EQ(*cast<IExpression>(*expr2).getFunction(), Add());
+
+  auto expr3 = makeExpr(Add(), ArgumentsPtrVector{var});
+  EXPECT_EQ(expr3->toString(), "a");
+}
+
 TEST(FunctionUtilsTests, makeExpressionCheckedAnyArgsTest) {
   Integer one = 1;
   Integer two = 2;
@@ -6,7 +6,9 @@
 #include "fintamath/functions/arithmetic/Sub.hpp"
 #include "fintamath/functions/arithmetic/UnaryPlus.hpp"
 #include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/IntegerFunctions.hpp"
 #include "fintamath/numbers/Rational.hpp"
+#include "fintamath/numbers/Real.hpp"
 
 using namespace fintamath;
 
@@ -47,6 +49,13 @@ TEST(LogTests, callTest) {
   EXPECT_EQ(f(Rational(40353607, 387420489), Rational(7, 9))->toString(), "1/9");
   EXPECT_EQ(f(Rational(387420489, 40353607), Rational(7, 9))->toString(), "-1/9");
 
+  EXPECT_EQ(f(Integer(2), pow(Integer(2), 100000))->toString(), "100000");
+  EXPECT_EQ(f(pow(Integer(3), 1000), pow(Integer(3), 200000))->toString(), "200");
+  EXPECT_EQ(f(pow(Integer(3), 200000), Integer(3))->toString(), "1/200000");
+  EXPECT_EQ(f(Rational(3, 2), Rational(pow(Integer(3), 1000), pow(Integer(2), 1000)))->toString(), "1000");
+  EXPECT_TRUE(is<Real>(f(Integer(2), pow(Integer(2), 100000) + 1)));
+  EXPECT_TRUE(is<Real>(f(Rational(3, 2), Rational(pow(Integer(3), 10), pow(Integer(2), 9)))));
+
   EXPECT_EQ(f(Integer(2), Integer(10))->toString(),
             "3.3219280948873623478703194294893901758648313930245806120547563958159347766086252");
   EXPECT_EQ(f(Integer(2), Integer(3))->toString(),
@@ -151,6 +151,9 @@ TEST(FactorialTests, equalsTest) {
   EXPECT_NE(Sub(), f);
   EXPECT_NE(f, UnaryPlus());
   EXPECT_NE(UnaryPlus(), f);
+  EXPECT_EQ(Factorial(2), Factorial(2));
+  EXPECT_NE(Factorial(2), f);
+  EXPECT_NE(Factorial(2).hash(), f.hash());
 }
 
 TEST(FactorialTests, getTypeIdTest) {
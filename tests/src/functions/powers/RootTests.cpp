@@ -4,6 +4,7 @@
 #include "fintamath/functions/powers/Root.hpp"
 
 #include "fintamath/literals/Variable.hpp"
+#include "fintamath/numbers/IntegerFunctions.hpp"
 #include "fintamath/numbers/Rational.hpp"
 #include "fintamath/numbers/Real.hpp"
 
@@ -33,6 +34,8 @@ TEST(RootTests, callTest) {
   EXPECT_EQ(f(Integer("992188888888"), Integer(2))->toString(), "2 sqrt(248047222222)");
   EXPECT_EQ(f(Integer("68732648273642987365932706179432649827364"), Integer(2))->toString(),
             "2 sqrt(17183162068410746841483176544858162456841)");
+  EXPECT_EQ(f(Integer("998244359987710471"), Integer(2))->toString(), "sqrt(998244359987710471)");
+  EXPECT_EQ(f(Integer("998244366975420990913973297"), Integer(2))->toString(), "1000000007 sqrt(998244353)");
   EXPECT_EQ(f(Integer(100), Integer(3))->toString(), "root(100, 3)");
   EXPECT_EQ(f(Integer(25), Integer(3))->toString(), "root(25, 3)");
   EXPECT_EQ(f(Integer(144), Integer(3))->toString(), "2 root(18, 3)");
@@ -47,6 +50,14 @@ TEST(RootTests, callTest) {
   EXPECT_EQ(f(Integer(1024), Integer(3))->toString(), "8 root(2, 3)");
   EXPECT_EQ(f(Integer(1024), Integer(5))->toString(), "4");
   EXPECT_EQ(f(Integer(1024), Integer(10))->toString(), "2");
+  EXPECT_EQ(f(Integer(248832), Integer(3))->toString(), "24 root(18, 3)");
+  EXPECT_EQ(f(pow(Integer(3), 700), Integer(7))->toString(), "515377520732011331036461129765621272702107522001");
+  EXPECT_EQ(f(pow(Integer("2305843009213693951"), 5), Integer(2))->toString(),
+            "5316911983139663487003542222693990401 sqrt(2305843009213693951)");
+  EXPECT_EQ(f(pow(Integer("2305843009213693951"), 6), Integer(4))->toString(),
+            "2305843009213693951 sqrt(2305843009213693951)");
+  EXPECT_EQ(f(pow(Integer("2305843009213693951"), 2), Integer(3))->toString(),
+            "root(5316911983139663487003542222693990401, 3)");
 
   EXPECT_EQ(f(Rational(25), Integer(4))->toString(), "sqrt(5)");
   EXPECT_EQ(f(Rational(25, 169), Integer(4))->toString(), "sqrt(65)/13");
@@ -68,9 +79,9 @@ TEST(RootTests, callTest) {
   EXPECT_EQ(f(Rational(26, 49), Rational(4, 3))->toString(), "(root(17576, 4) sqrt(7))/49");
   EXPECT_EQ(f(Rational(45, 67), Rational(4, 3))->toString(), "(3 sqrt(3) root(3400816799536868375, 4))/300763");
   EXPECT_EQ(f(Rational("68732648273642987365932706179432649827364.144"), Rational(4, 3))->toString(),
-            "root("
-            "7927372849382185275921948416295491006123802507980590928828502346035706866634512605547562725740337450714401"
-            "3103294156851180403979000, 4)/125");
+            "(sqrt(15312366163) "
+            "root(338099612740240260261269854591962270042940289036293347518355187536048028233003416531541714577494161249575891000,"
+            " 4))/125");
 
   EXPECT_EQ(f(Real(144), Integer(2))->toString(), "12.0");
   EXPECT_EQ(f(Real(144), Integer(4))->toString(),
@@ -100,6 +111,22 @@ TEST(RootTests, callTest) {
   EXPECT_THROW(f(Integer(1), Integer(1), Integer(1)), InvalidInputFunctionException);
 }
 
+TEST(RootTests, factorsMaxWorkTest) {
+  size_t maxWork = Root::getFactorsMaxWork();
+
+  Root::setFactorsMaxWork(0);
+  EXPECT_EQ(Root::getFactorsMaxWork(), 0);
+  EXPECT_EQ(f(Integer("998244366975420990913973297"), Integer(2))->toString(), "sqrt(998244366975420990913973297)");
+  EXPECT_EQ(f(Integer(4212), Integer(2))->toString(), "18 sqrt(13)");
+
+  Root::setFactorsMaxWork(maxWork);
+  EXPECT_EQ(f(Integer("998244366975420990913973297"), Integer(2))->toString(), "1000000007 sqrt(998244353)");
+
+  // Too big to test for primality within the default budget, so only small factors are extracted
+  EXPECT_EQ(f(pow(Integer(3), 2000) * 4 + 8, Integer(2))->toString(),
+            "2 sqrt(" + (pow(Integer(3), 2000) + 2).toString() + ")");
+}
+
 TEST(RootTests, getTypeIdTest) {
   EXPECT_EQ(Root::getTypeIdStatic(), MathObjectTypeId(MathObjectType::Root));
   EXPECT_EQ(Root().getTypeId(), MathObjectTypeId(MathObjectType::Root));
@@ -51,6 +51,18 @@ TEST(VariableTest, equalsTest) {
   EXPECT_NE(Variable("b"), a);
   EXPECT_NE(a, E());
   EXPECT_NE(E(), a);
+
+  EXPECT_EQ(Variable("a", 1), Variable("a", 1));
+  EXPECT_NE(Variable("a", 1), Variable("a", 2));
+  EXPECT_NE(Variable("a", 1), Variable("b", 1));
+  EXPECT_NE(Variable("a", 1), a);
+}
+
+TEST(VariableTest, hashTest) {
+  EXPECT_EQ(Variable("a").hash(), Variable("a").hash());
+  EXPECT_EQ(Variable("a", 10).hash(), Variable("a", 10).hash());
+  EXPECT_NE(Variable("a").hash(), Variable("b").hash());
+  EXPECT_NE(Variable("a", 1).hash(), Variable("a", 2).hash());
 }
 
 TEST(VariableTest, getTypeIdTest) {
@@ -101,6 +101,114 @@ TEST(IntegerFunctionsTests, sqrtWithRemainderTest) {
   EXPECT_THROW(sqrt(Integer(-9289), remainder), UndefinedFunctionException);
 }
 
+TEST(IntegerFunctionsTests, rootTest) {
+  Integer remainder;
+
+  EXPECT_EQ(root(Integer(0), Integer(3), remainder), 0);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer(1), Integer(5), remainder), 1);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer(10), Integer(1), remainder), 10);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer(35), Integer(2), remainder), 5);
+  EXPECT_EQ(remainder, 10);
+
+  EXPECT_EQ(root(Integer(1000), Integer(3), remainder), 10);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(Integer(999), Integer(3), remainder), 9);
+  EXPECT_EQ(remainder, 270);
+
+  EXPECT_EQ(root(Integer(7), Integer(100), remainder), 1);
+  EXPECT_EQ(remainder, 6);
+
+  EXPECT_EQ(root(Integer("1000000000000000000000000000005"), Integer(7), remainder), 19306);
+  EXPECT_EQ(remainder.toString(), "354275191166257706049454469");
+
+  EXPECT_EQ(root(Integer("18446744073709551616"), Integer(5), remainder), 7131);
+  EXPECT_EQ(remainder, Integer("7114933042826965"));
+
+  EXPECT_EQ(root(Integer("12345678901234567890123"), Integer(4), remainder), 333333);
+  EXPECT_EQ(remainder, Integer("49271530864235802"));
+
+  EXPECT_EQ(root(pow(Integer(3), 70000), Integer(7), remainder), pow(Integer(3), 10000));
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(root(pow(Integer(3), 70000) - 1, Integer(7), remainder), pow(Integer(3), 10000) - 1);
+  EXPECT_EQ(remainder, pow(Integer(3), 70000) - 1 - pow(pow(Integer(3), 10000) - 1, 7));
+
+  EXPECT_THROW(root(Integer(-8), Integer(3), remainder), UndefinedFunctionException);
+  EXPECT_THROW(root(Integer(8), Integer(0), remainder), UndefinedFunctionException);
+}
+
+TEST(IntegerFunctionsTests, perfectPowerTest) {
+  Integer exponent;
+
+  EXPECT_EQ(perfectPower(Integer(2), exponent), 2);
+  EXPECT_EQ(exponent, 1);
+
+  EXPECT_EQ(perfectPower(Integer(1024), exponent), 2);
+  EXPECT_EQ(exponent, 10);
+
+  EXPECT_EQ(perfectPower(Integer(144), exponent), 12);
+  EXPECT_EQ(exponent, 2);
+
+  EXPECT_EQ(perfectPower(Integer(248832), exponent), 12);
+  EXPECT_EQ(exponent, 5);
+
+  EXPECT_EQ(perfectPower(Integer(4212), exponent), 4212);
+  EXPECT_EQ(exponent, 1);
+
+  EXPECT_EQ(perfectPower(pow(Integer(10), 52), exponent), 10);
+  EXPECT_EQ(exponent, 52);
+
+  EXPECT_EQ(perfectPower(pow(Integer("2305843009213693951"), 35), exponent), Integer("2305843009213693951"));
+  EXPECT_EQ(exponent, 35);
+
+  EXPECT_EQ(perfectPower(pow(Integer(6), 1001), exponent), 6);
+  EXPECT_EQ(exponent, 1001);
+
+  EXPECT_EQ(perfectPower(pow(Integer(3), 20000) + 2, exponent), pow(Integer(3), 20000) + 2);
+  EXPECT_EQ(exponent, 1);
+
+  EXPECT_THROW(perfectPower(Integer(1), exponent), UndefinedFunctionException);
+  EXPECT_THROW(perfectPower(Integer(-8), exponent), UndefinedFunctionException);
+}
+
+TEST(IntegerFunctionsTests, logTest) {
+  Integer remainder;
+
+  EXPECT_EQ(log(Integer(2), Integer(1), remainder), 0);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(log(Integer(7), Integer(6), remainder), 0);
+  EXPECT_EQ(remainder, 5);
+
+  EXPECT_EQ(log(Integer(2), Integer(1024), remainder), 10);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(log(Integer(10), Integer(999), remainder), 2);
+  EXPECT_EQ(remainder, 899);
+
+  EXPECT_EQ(log(Integer(10), Integer("1000000000000000000000000000000"), remainder), 30);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(log(Integer(3), pow(Integer(3), 20000), remainder), 20000);
+  EXPECT_EQ(remainder, 0);
+
+  EXPECT_EQ(log(Integer(3), pow(Integer(3), 20000) - 1, remainder), 19999);
+  EXPECT_EQ(remainder, 2 * pow(Integer(3), 19999) - 1);
+
+  EXPECT_EQ(log(pow(Integer(12345), 7), pow(Integer(12345), 700) + 1, remainder), 100);
+  EXPECT_EQ(remainder, 1);
+
+  EXPECT_THROW(log(Integer(1), Integer(10), remainder), UndefinedFunctionException);
+  EXPECT_THROW(log(Integer(2), Integer(0), remainder), UndefinedFunctionException);
+}
+
 TEST(IntegerFunctionsTests, powTest) {
   EXPECT_EQ(pow(Integer(5), Integer(2)), 25);
   EXPECT_EQ(pow(Integer(-5), Integer(5)), -3125);
@@ -127,6 +235,16 @@ TEST(IntegerFunctionsTests, powTest) {
   EXPECT_EQ(pow(Real(6789), Integer(-4)).toString(),
             "4.7073529830645308411980456378106763573183149819028161454972767500068746591107477*10^-16");
 
+  EXPECT_EQ(pow(Integer(2), Integer(100000)).bitLength(), 100001);
+  EXPECT_EQ(pow(Integer(7), Integer(1000)) % pow(Integer(10), Integer(20)), Integer("71141207731280600001"));
+  EXPECT_EQ(pow(Integer(3), Integer(12345)).toString().size(), 5891);
+  EXPECT_EQ(pow(Integer(3), Integer(12345)) % pow(Integer(10), Integer(20)), Integer("53440836608065156643"));
+  EXPECT_EQ(pow(Integer(-1), Integer("1000000000000000000000000000001")), -1);
+  EXPECT_EQ(pow(Rational(-1, 2), Integer(201)).denominator(), pow(Integer(2), Integer(201)));
+  EXPECT_EQ(pow(Rational(-1, 2), Integer(201)).numerator(), -1);
+  EXPECT_EQ(pow(Rational(2, 3), Integer(-3)).toString(), "27/8");
+  EXPECT_EQ(pow(Real("1.5"), Integer(2)).toString(), "2.25");
+
   EXPECT_THROW(pow(Integer(0), Integer(0)), UndefinedBinaryOperatorException);
   EXPECT_THROW(pow(Rational(0), Integer(0)), UndefinedBinaryOperatorException);
   EXPECT_THROW(pow(Rational(0), Integer(0)), UndefinedBinaryOperatorException);
@@ -141,6 +259,12 @@ TEST(IntegerFunctionsTests, factorialTest) {
   EXPECT_EQ(factorial(Integer(5)), 120);
   EXPECT_EQ(factorial(Integer(10)), 3628800);
   EXPECT_EQ(factorial(Integer(25)).toString(), "15511210043330985984000000");
+  EXPECT_EQ(factorial(Integer(21)).toString(), "51090942171709440000");
+  EXPECT_EQ(factorial(Integer(30)).toString(), "265252859812191058636308480000000");
+
+  Integer bigFactorial = factorial(Integer(100000));
+  EXPECT_EQ(bigFactorial.bitLength(), 1516705);
+  EXPECT_EQ(bigFactorial % Integer(1000000007), 457992974);
 
   EXPECT_THROW(factorial(Integer(-1)), UndefinedUnaryOperatorException);
   EXPECT_THROW(factorial(Integer(-2)), UndefinedUnaryOperatorException);
@@ -183,6 +307,12 @@ TEST(IntegerFunctionsTests, nthFactorialTest) {
   EXPECT_EQ(factorial(Integer(10), 10), 10);
   EXPECT_EQ(factorial(Integer(25), 10).toString(), "1875");
 
+  EXPECT_EQ(factorial(Integer(99), 2).toString(),
+            "2725392139750729502980713245400918633290796330545803413734328823443106201171875");
+  EXPECT_EQ(factorial(Integer(100000), 2) % Integer(1000000007), 158002026);
+  EXPECT_EQ(factorial(Integer(99999), 2) % Integer(1000000007), 660115543);
+  EXPECT_EQ(factorial(Integer(100001), 7) % Integer(1000000007), 635672475);
+
   EXPECT_THROW(factorial(Integer(-1), 1), UndefinedUnaryOperatorException);
   EXPECT_THROW(factorial(Integer(-1), 20), UndefinedUnaryOperatorException);
   EXPECT_THROW(factorial(Integer(-2), 1), UndefinedUnaryOperatorException);
@@ -232,15 +362,78 @@ TEST(IntegerFunctionsTests, factorsTest) {
   EXPECT_EQ(factorRates[59], 1);
   EXPECT_EQ(factorRates[Integer("7406060776921378681")], 1);
 
+  factorRates = factors(Integer("998244359987710471"));
+  EXPECT_EQ(factorRates.size(), 2);
+  EXPECT_EQ(factorRates[998244353], 1);
+  EXPECT_EQ(factorRates[1000000007], 1);
+
+  factorRates = factors(Integer("1000000014000000049"));
+  EXPECT_EQ(factorRates.size(), 1);
+  EXPECT_EQ(factorRates[1000000007], 2);
+
+  factorRates = factors(Integer("139826427468275632"));
+  EXPECT_EQ(factorRates.size(), 6);
+  EXPECT_EQ(factorRates[1093], 1);
+  EXPECT_EQ(factorRates[Integer("2167406951")], 1);
+
   EXPECT_THROW(factors(-1), UndefinedFunctionException);
   EXPECT_THROW(factors(0), UndefinedFunctionException);
   EXPECT_THROW(factors(1), UndefinedFunctionException);
 }
 
+TEST(IntegerFunctionsTests, factorsWithBudgetTest) {
+  std::map<Integer, Integer> factorRates;
+
+  factorRates = factorsWithBudget(Integer("998244359987710471"), 0);
+  EXPECT_EQ(factorRates.size(), 1);
+  EXPECT_EQ(factorRates[Integer("998244359987710471")], 1);
+
+  factorRates = factorsWithBudget(Integer("266160000000000000000"), 0);
+  EXPECT_EQ(factorRates.size(), 4);
+  EXPECT_EQ(factorRates[2], 19);
+  EXPECT_EQ(factorRates[3], 1);
+  EXPECT_EQ(factorRates[5], 16);
+  EXPECT_EQ(factorRates[1109], 1);
+
+  factorRates = factorsWithBudget(Integer("998244359987710471"), 1 << 24);
+  EXPECT_EQ(factorRates.size(), 2);
+  EXPECT_EQ(factorRates[998244353], 1);
+  EXPECT_EQ(factorRates[1000000007], 1);
+
+  EXPECT_THROW(factorsWithBudget(1, 0), UndefinedFunctionException);
+}
+
+TEST(IntegerFunctionsTests, isPrimeTest) {
+  EXPECT_FALSE(isPrime(-7));
+  EXPECT_FALSE(isPrime(0));
+  EXPECT_FALSE(isPrime(1));
+  EXPECT_TRUE(isPrime(2));
+  EXPECT_TRUE(isPrime(3));
+  EXPECT_FALSE(isPrime(4));
+  EXPECT_TRUE(isPrime(65537));
+  EXPECT_FALSE(isPrime(3215031751));
+  EXPECT_TRUE(isPrime(1000000007));
+  EXPECT_FALSE(isPrime(Integer("998244359987710471")));
+  EXPECT_TRUE(isPrime(Integer("170141183460469231731687303715884105727")));
+  EXPECT_FALSE(isPrime(Integer("318665857834031151167461")));
+
+  // Strong pseudoprime to the bases from 2 to 37, above the deterministic bound
+  EXPECT_FALSE(isPrime(Integer("3317044064679887385961981")));
+  EXPECT_TRUE(isPrime(pow(Integer(2), 521) - 1));
+  EXPECT_FALSE(isPrime((pow(Integer(2), 89) - 1) * (pow(Integer(2), 107) - 1)));
+  EXPECT_FALSE(isPrime(pow(pow(Integer(2), 89) - 1, 2)));
+}
+
 TEST(IntegerFunctionsTests, combinationsTest) {
   EXPECT_EQ(combinations(Integer(6), Integer(2)), 15);
   EXPECT_EQ(combinations(Integer(10), Integer(7)), 120);
   EXPECT_EQ(combinations(Integer(15), Integer(2)), 105);
+  EXPECT_EQ(combinations(Integer(15), Integer(0)), 1);
+  EXPECT_EQ(combinations(Integer(15), Integer(15)), 1);
+  EXPECT_EQ(combinations(Integer(100000), Integer(3)), Integer("166661666700000"));
+  EXPECT_EQ(combinations(Integer(100000), Integer(50000)) % Integer(1000000007), 149033233);
+  EXPECT_EQ(combinations(Integer("1000000000000000000000000000000"), Integer(2)).toString(),
+            "499999999999999999999999999999500000000000000000000000000000");
 
   EXPECT_THROW(combinations(Integer(20), Integer(40)), UndefinedFunctionException);
   EXPECT_THROW(combinations(Integer(-3), Integer(-8)), UndefinedUnaryOperatorException);
@@ -252,10 +445,16 @@ TEST(IntegerFunctionsTests, multinomialCoefficientTest) {
   EXPECT_EQ(multinomialCoefficient(Integer(8), {Integer(8)}), 1);
   EXPECT_EQ(multinomialCoefficient(Integer(5), {Integer(3), Integer(2)}), 10);
   EXPECT_EQ(multinomialCoefficient(Integer(12), {Integer(3), Integer(9), Integer(0)}), 220);
+  EXPECT_EQ(multinomialCoefficient(Integer(30000), {Integer(10000), Integer(10000), Integer(10000)}) % Integer(1000000007), 579602088);
+  EXPECT_EQ(multinomialCoefficient(Integer("1000000000000000000000000000000"),
+                                   {Integer("999999999999999999999999999998"), Integer(2)})
+                .toString(),
+            "499999999999999999999999999999500000000000000000000000000000");
 
   EXPECT_THROW(multinomialCoefficient(Integer(12), {Integer(3)}), UndefinedFunctionException);
   EXPECT_THROW(multinomialCoefficient(Integer(12), {Integer(3), Integer(19), Integer(0)}), UndefinedFunctionException);
   EXPECT_THROW(multinomialCoefficient(Integer(12), {Integer(0)}), UndefinedFunctionException);
   EXPECT_THROW(multinomialCoefficient(Integer(-12), {Integer(3), Integer(9), Integer(0)}), UndefinedFunctionException);
   EXPECT_THROW(multinomialCoefficient(Integer(12), {Integer(-3), Integer(9), Integer(0)}), UndefinedFunctionException);
+  EXPECT_THROW(multinomialCoefficient(Integer(12), {Integer(-3), Integer(15)}), UndefinedFunctionException);
 }
@@ -4,6 +4,7 @@
 
 #include "fintamath/exceptions/InvalidInputException.hpp"
 #include "fintamath/exceptions/UndefinedException.hpp"
+#include "fintamath/numbers/IntegerFunctions.hpp"
 #include "fintamath/numbers/Rational.hpp"
 
 using namespace fintamath;
@@ -24,6 +25,24 @@ TEST(IntegerTests, stringConstructorTest) {
   EXPECT_THROW(Integer("+"), InvalidInputException);
 }
 
+TEST(IntegerTests, tryParseTest) {
+  EXPECT_EQ(*Integer::tryParse("10"), 10);
+  EXPECT_EQ(*Integer::tryParse("-10"), -10);
+  EXPECT_EQ(*Integer::tryParse("007"), 7);
+  EXPECT_EQ(*Integer::tryParse("-0"), 0);
+  EXPECT_EQ(*Integer::tryParse("999999999999999999"), Integer("999999999999999999"));
+  EXPECT_EQ(Integer::tryParse("2432432423432432454745")->toString(), "2432432423432432454745");
+  EXPECT_EQ(Integer::tryParse("-0002432432423432432454745")->toString(), "-2432432423432432454745");
+
+  EXPECT_FALSE(Integer::tryParse(""));
+  EXPECT_FALSE(Integer::tryParse("-"));
+  EXPECT_FALSE(Integer::tryParse("+"));
+  EXPECT_FALSE(Integer::tryParse("--10"));
+  EXPECT_FALSE(Integer::tryParse("1.5"));
+  EXPECT_FALSE(Integer::tryParse("0x10"));
+  EXPECT_FALSE(Integer::tryParse("test"));
+}
+
 TEST(IntegerTests, templateConstructorTest) {
   EXPECT_EQ(Integer(std::numeric_limits<uint64_t>::max()).toString(), "18446744073709551615");
   EXPECT_EQ(Integer(std::numeric_limits<int64_t>::min()).toString(), "-9223372036854775808");
@@ -363,6 +382,20 @@ TEST(IntegerTests, multiplyOperatorTest) {
             Integer("224388872686866615413795053083509315281416419176500823292877913926466185818904"));
 }
 
+TEST(IntegerTests, hugeMultiplyOperatorTest) {
+  // Above the size threshold of the transform multiplication, checked against boost multiplication
+  const Integer lhs = pow(Integer(3), 700000) + 12345;
+  const Integer rhs = -pow(Integer(7), 400000) + 1;
+
+  EXPECT_EQ(lhs * rhs, Integer(lhs.getBackend() * rhs.getBackend()));
+  EXPECT_EQ(rhs * lhs, Integer(lhs.getBackend() * rhs.getBackend()));
+  EXPECT_EQ(rhs * rhs, Integer(rhs.getBackend() * rhs.getBackend()));
+
+  Integer square = lhs;
+  square *= square;
+  EXPECT_EQ(square, Integer(lhs.getBackend() * lhs.getBackend()));
+}
+
 TEST(IntegerTests, intMultiplyOperatorTest) {
   EXPECT_EQ(Integer(5) * 10, 50);
 }
@@ -465,6 +498,22 @@ TEST(IntegerTests, divideOperatorTest) {
             Integer("10427979792028556925767245809751978965181020274175"));
 }
 
+TEST(IntegerTests, hugeDivideOperatorTest) {
+  // Above the size threshold of the Newton division, checked against boost division
+  const Integer lhs = pow(Integer(3), 500000) - 1;
+  const Integer rhs = pow(Integer(5), 120000) + 7;
+  const Integer product = lhs * rhs;
+
+  EXPECT_EQ(product / rhs, lhs);
+  EXPECT_EQ(product / lhs, rhs);
+  EXPECT_EQ((product - 1) / rhs, lhs - 1);
+  EXPECT_EQ((product + rhs - 1) / rhs, lhs);
+  EXPECT_EQ(lhs / rhs, Integer(lhs.getBackend() / rhs.getBackend()));
+  EXPECT_EQ(-lhs / rhs, Integer(-lhs.getBackend() / rhs.getBackend()));
+  EXPECT_EQ(lhs / -rhs, Integer(lhs.getBackend() / -rhs.getBackend()));
+  EXPECT_EQ(-lhs / -rhs, Integer(lhs.getBackend() / rhs.getBackend()));
+}
+
 TEST(IntegerTests, intDivideOperatorTest) {
   EXPECT_EQ(Integer(10) / 5, 2);
 }
@@ -500,6 +549,19 @@ TEST(IntegerTests, moduloOperatorTest) {
             Integer("25193809905191080888100466723580"));
 }
 
+TEST(IntegerTests, hugeModuloOperatorTest) {
+  // Above the size threshold of the Newton division, checked against boost division
+  const Integer lhs = pow(Integer(3), 500000) - 1;
+  const Integer rhs = pow(Integer(5), 120000) + 7;
+
+  EXPECT_EQ((lhs * rhs + 12345) % rhs, 12345);
+  EXPECT_EQ((lhs * rhs - 1) % rhs, rhs - 1);
+  EXPECT_EQ(lhs % rhs, Integer(lhs.getBackend() % rhs.getBackend()));
+  EXPECT_EQ(-lhs % rhs, Integer(-lhs.getBackend() % rhs.getBackend()));
+  EXPECT_EQ(lhs % -rhs, Integer(lhs.getBackend() % -rhs.getBackend()));
+  EXPECT_EQ(-lhs % -rhs, Integer(-lhs.getBackend() % -rhs.getBackend()));
+}
+
 TEST(IntegerTests, intModuloOperatorTest) {
   EXPECT_EQ(Integer(10) % 4, 2);
 }
@@ -800,6 +862,25 @@ TEST(IntegerTests, toStringTest) {
   EXPECT_EQ(Integer("618288").toString(), "618288");
   EXPECT_EQ(Integer("0").toString(), "0");
   EXPECT_EQ(Integer("-738").toString(), "-738");
+
+  // Long numbers are split by powers of 10, so the inner zeros must be kept
+  std::string digits;
+
+  for (size_t i = 0; i < 10000; i++) {
+    digits += "1234567890";
+  }
+
+  EXPECT_EQ(Integer(digits).toString(), digits);
+  EXPECT_EQ(Integer("-" + digits).toString(), "-" + digits);
+  EXPECT_EQ(Integer(digits).getBackend(), boost::multiprecision::cpp_int(digits));
+
+  const std::string powerDigits = "1" + std::string(100000, '0');
+  EXPECT_EQ(pow(Integer(10), 100000).toString(), powerDigits);
+  EXPECT_EQ(Integer(powerDigits), pow(Integer(10), 100000));
+
+  const std::string innerZerosDigits = "7" + std::string(50000, '0') + "3" + std::string(3000, '0') + "1";
+  EXPECT_EQ(Integer(innerZerosDigits).toString(), innerZerosDigits);
+  EXPECT_EQ(Integer("000" + innerZerosDigits).toString(), innerZerosDigits);
 }
 
 TEST(IntegerTests, signTest) {
@@ -810,6 +891,55 @@ TEST(IntegerTests, signTest) {
   EXPECT_EQ(Integer(2).sign(), 1);
 }
 
+TEST(IntegerTests, hashTest) {
+  EXPECT_EQ(Integer(0).hash(), Integer().hash());
+  EXPECT_EQ(Integer(-5).hash(), Integer("-5").hash());
+  EXPECT_NE(Integer(5).hash(), Integer(-5).hash());
+  EXPECT_EQ(Integer("100000000000000000000000000000").hash(), Integer("100000000000000000000000000000").hash());
+  EXPECT_NE(Integer("100000000000000000000000000000").hash(), Integer("-100000000000000000000000000000").hash());
+  EXPECT_NE(Integer("100000000000000000000000000000").hash(), Integer("100000000000000000000000000001").hash());
+}
+
+TEST(IntegerTests, bitLengthTest) {
+  EXPECT_EQ(Integer(0).bitLength(), 0);
+  EXPECT_EQ(Integer(1).bitLength(), 1);
+  EXPECT_EQ(Integer(-1).bitLength(), 1);
+  EXPECT_EQ(Integer(255).bitLength(), 8);
+  EXPECT_EQ(Integer(-256).bitLength(), 9);
+  EXPECT_EQ(Integer(std::numeric_limits<int64_t>::max()).bitLength(), 63);
+  EXPECT_EQ(Integer(std::numeric_limits<int64_t>::min()).bitLength(), 64);
+  EXPECT_EQ(Integer("340282366920938463463374607431768211456").bitLength(), 129);
+  EXPECT_EQ(Integer("-340282366920938463463374607431768211455").bitLength(), 128);
+}
+
+TEST(IntegerTests, bitTest) {
+  EXPECT_FALSE(Integer(0).bit(0));
+  EXPECT_TRUE(Integer(5).bit(0));
+  EXPECT_FALSE(Integer(5).bit(1));
+  EXPECT_TRUE(Integer(5).bit(2));
+  EXPECT_FALSE(Integer(5).bit(100));
+  EXPECT_TRUE(Integer(-6).bit(1));
+  EXPECT_FALSE(Integer(-6).bit(0));
+  EXPECT_TRUE(Integer(std::numeric_limits<int64_t>::min()).bit(63));
+  EXPECT_TRUE(Integer("340282366920938463463374607431768211456").bit(128));
+  EXPECT_FALSE(Integer("340282366920938463463374607431768211456").bit(127));
+  EXPECT_TRUE(Integer("-340282366920938463463374607431768211457").bit(0));
+}
+
+TEST(IntegerTests, getBackendTest) {
+  boost::multiprecision::cpp_int buffer;
+
+  Integer small = 123;
+  EXPECT_EQ(&small.getBackend(buffer), &buffer);
+  EXPECT_EQ(buffer, 123);
+  EXPECT_EQ(small.getBackend(), 123);
+
+  Integer big("123456789012345678901234567890");
+  EXPECT_NE(&big.getBackend(buffer), &buffer);
+  EXPECT_EQ(big.getBackend(buffer), big.getBackend());
+  EXPECT_EQ(buffer, 123);
+}
+
 TEST(IntegerTests, intOperatorTest) {
   EXPECT_EQ(int64_t(Integer(-2)), -2);
   EXPECT_EQ(int64_t(Integer(10)), 10);
@@ -838,3 +968,45 @@ TEST(IntegerTests, getTypeIdTest) {
   EXPECT_EQ(Integer::getTypeIdStatic(), MathObjectTypeId(MathObjectType::Integer));
   EXPECT_EQ(Integer().getTypeId(), MathObjectTypeId(MathObjectType::Integer));
 }
+
+TEST(IntegerTests, smallBoundaryTest) {
+  const Integer max(std::numeric_limits<int64_t>::max());
+  const Integer min(std::numeric_limits<int64_t>::min());
+
+  EXPECT_EQ((max + 1).toString(), "9223372036854775808");
+  EXPECT_EQ((min - 1).toString(), "-9223372036854775809");
+  EXPECT_EQ((max * 2).toString(), "18446744073709551614");
+  EXPECT_EQ((min * -1).toString(), "9223372036854775808");
+  EXPECT_EQ((min / -1).toString(), "9223372036854775808");
+  EXPECT_EQ(min % -1, 0);
+  EXPECT_EQ((-min).toString(), "9223372036854775808");
+  EXPECT_EQ((~min).toString(), "9223372036854775807");
+
+  EXPECT_EQ(max + 1 - 1, max);
+  EXPECT_EQ(min - 1 + 1, min);
+  EXPECT_EQ(max * max / max, max);
+  EXPECT_EQ(-(-min), min);
+
+  Integer a = max;
+  ++a;
+  EXPECT_EQ(a.toString(), "9223372036854775808");
+  --a;
+  EXPECT_EQ(a, max);
+
+  a = min;
+  --a;
+  EXPECT_EQ(a.toString(), "-9223372036854775809");
+  ++a;
+  EXPECT_EQ(a, min);
+
+  EXPECT_LT(min - 1, min);
+  EXPECT_LT(min, max);
+  EXPECT_LT(max, max + 1);
+  EXPECT_GT(max + 1, min - 1);
+  EXPECT_NE(max + 1, max);
+
+  EXPECT_EQ(Integer(std::numeric_limits<uint64_t>::max()).toString(), "18446744073709551615");
+  EXPECT_EQ(Integer(std::numeric_limits<uint64_t>::max()) - Integer(std::numeric_limits<uint64_t>::max()), 0);
+  EXPECT_EQ(Integer("9223372036854775807"), max);
+  EXPECT_EQ(Integer("-9223372036854775808"), min);
+}
@@ -39,6 +39,23 @@ TEST(RationalTests, stringConstructorTest) {
   EXPECT_THROW(Rational("1.10.1"), InvalidInputException);
 }
 
+TEST(RationalTests, tryParseTest) {
+  EXPECT_EQ(*Rational::tryParse("2"), 2);
+  EXPECT_EQ(Rational::tryParse("-9.3")->toString(), "-93/10");
+  EXPECT_EQ(Rational::tryParse(".25")->toString(), "1/4");
+  EXPECT_EQ(Rational::tryParse("-1.")->toString(), "-1");
+  EXPECT_EQ(Rational::tryParse("0989929039237832000.9302930929333")->toString(),
+            "9899290392378320009302930929333/10000000000000");
+
+  EXPECT_FALSE(Rational::tryParse(""));
+  EXPECT_FALSE(Rational::tryParse("."));
+  EXPECT_FALSE(Rational::tryParse("-."));
+  EXPECT_FALSE(Rational::tryParse("1.2.1"));
+  EXPECT_FALSE(Rational::tryParse("10.-1"));
+  EXPECT_FALSE(Rational::tryParse("1-0.1"));
+  EXPECT_FALSE(Rational::tryParse("1.1a"));
+}
+
 TEST(RationalTests, integerIntegerConstructorTest) {
   EXPECT_EQ(Rational(-380, -608).toString(), "5/8");
   EXPECT_EQ(Rational(2849300, 18493).toString(), "2849300/18493");
@@ -485,6 +502,13 @@ TEST(RationalTests, simplifyTest) {
   EXPECT_EQ(Rational(-55, 5).toMinimalObject()->toString(), "-11");
 }
 
+TEST(RationalTests, hashTest) {
+  EXPECT_EQ(Rational(1, 2).hash(), Rational(2, 4).hash());
+  EXPECT_NE(Rational(1, 2).hash(), Rational(-1, 2).hash());
+  EXPECT_NE(Rational(1, 2).hash(), Rational(1, 3).hash());
+  EXPECT_EQ(Rational(3).hash(), Integer(3).hash());
+}
+
 TEST(RationalTests, signTests) {
   EXPECT_EQ(Rational(-2).sign(), -1);
   EXPECT_EQ(Rational(-1).sign(), -1);
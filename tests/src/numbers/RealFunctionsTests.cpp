@@ -284,3 +284,13 @@ TEST(RealFunctionsTests, tgammaTest) {
   EXPECT_THROW(tgamma(Real("1000000000")), UndefinedFunctionException);
   EXPECT_THROW(tgamma(Real("-1000000000")), UndefinedFunctionException);
 }
+
+TEST(RealFunctionsTests, getLn2Test) {
+  EXPECT_EQ(getLn2().toString(), "0.69314718055994530941723212145817656807550013436025525412068000949339362196969472");
+  EXPECT_EQ(&getLn2(), &getLn2());
+}
+
+TEST(RealFunctionsTests, getLn10Test) {
+  EXPECT_EQ(getLn10().toString(), "2.3025850929940456840179914546843642076011014886287729760333279009675726096773525");
+  EXPECT_EQ(&getLn10(), &getLn10());
+}
@@ -41,6 +41,20 @@ TEST(RealTests, stringConstructorTest) {
   EXPECT_THROW(Real("1.2.1"), InvalidInputException);
 }
 
+TEST(RealTests, tryParseTest) {
+  EXPECT_EQ(*Real::tryParse("-93"), -93);
+  EXPECT_EQ(Real::tryParse("-9.3")->toString(), "-9.3");
+  EXPECT_EQ(Real::tryParse("00.1")->toString(), "0.1");
+  EXPECT_EQ(Real::tryParse("1.")->toString(), "1.0");
+
+  EXPECT_FALSE(Real::tryParse(""));
+  EXPECT_FALSE(Real::tryParse("."));
+  EXPECT_FALSE(Real::tryParse("-"));
+  EXPECT_FALSE(Real::tryParse("1.2.1"));
+  EXPECT_FALSE(Real::tryParse("10.-1"));
+  EXPECT_FALSE(Real::tryParse("1e5"));
+}
+
 TEST(RealTests, rationalConstructorTest) {
   EXPECT_EQ(Real(Rational(2, 5)).toString(), "0.4");
   EXPECT_EQ(Real(Rational(-2, 5)).toString(), "-0.4");
@@ -853,6 +867,22 @@ TEST(RealTests, toStringTest) {
       "-1.0*10^90");
 }
 
+TEST(RealTests, appendStringTest) {
+  std::string buffer = "[";
+
+  Real("2.334455").appendString(buffer);
+  buffer += ", ";
+  Real(-11).appendString(buffer);
+  buffer += ", ";
+  Real("-1000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000").appendString(buffer);
+  buffer += ", ";
+  Real("0.00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000012").appendString(buffer);
+  buffer += "]";
+
+  EXPECT_EQ(buffer, "[2.334455, -11.0, -1.0*10^90, 1.2*10^-100]");
+  EXPECT_EQ(Real("0.000012").toString(), "1.2*10^-5");
+}
+
 TEST(RealTests, preciseTests) {
   Real val = Rational(1, 3);
 
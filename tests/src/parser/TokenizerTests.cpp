@@ -0,0 +1,20 @@
+#include <gtest/gtest.h>
+
+#include "fintamath/parser/Tokenizer.hpp"
+
+#include "fintamath/expressions/Expression.hpp"
+
+using namespace fintamath;
+
+TEST(TokenizerTests, tokenizeTest) {
+  EXPECT_EQ(Tokenizer::tokenize(""), TokenVector{});
+  EXPECT_EQ(Tokenizer::tokenize("  "), TokenVector{});
+  EXPECT_EQ(Tokenizer::tokenize("123"), TokenVector{"123"});
+  EXPECT_EQ(Tokenizer::tokenize("1.5 2"), (TokenVector{"1.5", "2"}));
+  EXPECT_EQ(Tokenizer::tokenize("sin(x)+2.5*ln y"), (TokenVector{"sin", "(", "x", ")", "+", "2.5", "*", "ln", "y"}));
+  EXPECT_EQ(Tokenizer::tokenize("sinx"), (TokenVector{"sin", "x"}));
+  EXPECT_EQ(Tokenizer::tokenize("a<=b<c"), (TokenVector{"a", "<=", "b", "<", "c"}));
+  EXPECT_EQ(Tokenizer::tokenize("2xy"), (TokenVector{"2", "x", "y"}));
+  EXPECT_EQ(Tokenizer::tokenize("a \t\r\n  b\n"), (TokenVector{"a", "b"}));
+  EXPECT_EQ(Tokenizer::tokenize("#@"), (TokenVector{"#", "@"}));
+}